@@ -69,7 +69,7 @@ class configuration:
   # Compile using ccache (for developers needing fast recompilation)
   with_ccache = False
 
-  # Compile code with debug symbols (ie, -g)
+  # Compile code with debug symbols (ie, -g) and count heap allocations
   debug_mode = False
 
   # Compile code with debug symbols (ie, -g, -pg)
@@ -87,7 +87,7 @@ class configuration:
   with_numpy = True
 
   # The vector length used for the VectorizedSolver class. This will used
-  # as a hint for the Intel compiler to issue SIMD (ie, SSE, AVX, etc) vector
+  # as a hint for the compiler to issue SIMD (ie, SSE, AVX, etc) vector
   # instructions. This is accomplished by adding "dummy" energy groups such
   # that the number of energy groups is be fit too a multiple of this
   # vector_length, and restructuring the innermost loops in the solver to
@@ -123,6 +123,7 @@ class configuration:
   sources['gcc'] = ['openmoc/openmoc_wrap.cpp',
                     'src/Cell.cpp',
                     'src/Geometry.cpp',
+                    'src/FSRRegistry.cpp',
                     'src/LocalCoords.cpp',
                     'src/log.cpp',
                     'src/Material.cpp',
@@ -130,6 +131,9 @@ class configuration:
                     'src/Quadrature.cpp',
                     'src/Solver.cpp',
                     'src/CPUSolver.cpp',
+                    'src/ThreadPrivateSolver.cpp',
+                    'src/VectorizedSolver.cpp',
+                    'src/VectorizedPrivateSolver.cpp',
                     'src/Surface.cpp',
                     'src/Timer.cpp',
                     'src/Track.cpp',
@@ -140,6 +144,7 @@ class configuration:
   sources['icpc'] = ['openmoc/openmoc_wrap.cpp',
                      'src/Cell.cpp',
                      'src/Geometry.cpp',
+                     'src/FSRRegistry.cpp',
                      'src/LocalCoords.cpp',
                      'src/log.cpp',
                      'src/Material.cpp',
@@ -147,7 +152,9 @@ class configuration:
                      'src/Quadrature.cpp',
                      'src/Solver.cpp',
                      'src/CPUSolver.cpp',
+                     'src/ThreadPrivateSolver.cpp',
                      'src/VectorizedSolver.cpp',
+                     'src/VectorizedPrivateSolver.cpp',
                      'src/Surface.cpp',
                      'src/Timer.cpp',
                      'src/Track.cpp',
@@ -158,6 +165,7 @@ class configuration:
   sources['bgxlc'] = ['openmoc/openmoc_wrap.cpp',
                       'src/Cell.cpp',
                       'src/Geometry.cpp',
+                      'src/FSRRegistry.cpp',
                       'src/LocalCoords.cpp',
                       'src/log.cpp',
                       'src/Material.cpp',
@@ -165,6 +173,7 @@ class configuration:
                       'src/Quadrature.cpp',
                       'src/Solver.cpp',
                       'src/CPUSolver.cpp',
+                      'src/ThreadPrivateSolver.cpp',
                       'src/Surface.cpp',
                       'src/Timer.cpp',
                       'src/Track.cpp',
@@ -229,7 +238,7 @@ class configuration:
 
   shared_libraries['gcc'] = ['stdc++', 'gomp', 'dl','pthread', 'm']
   shared_libraries['icpc'] = ['stdc++', 'iomp5', 'pthread', 'irc',
-                              'imf','rt', 'mkl_rt','m',]
+                              'imf','rt','m',]
   shared_libraries['bgxlc'] = ['stdc++', 'pthread', 'm', 'xlsmp', 'rt']
   shared_libraries['nvcc'] = ['cudart']
 
@@ -298,7 +307,6 @@ class configuration:
   macros['icpc']['single']= [('FP_PRECISION', 'float'),
                              ('SINGLE', None),
                              ('INTEL', None),
-                             ('MKL_ILP64', None),
                              ('VEC_LENGTH', vector_length),
                              ('VEC_ALIGNMENT', vector_alignment)]
 
@@ -323,7 +331,6 @@ class configuration:
   macros['icpc']['double'] = [('FP_PRECISION', 'double'),
                               ('DOUBLE', None),
                               ('INTEL', None),
-                              ('MKL_ILP64', None),
                               ('VEC_LENGTH', vector_length),
                               ('VEC_ALIGNMENT', vector_alignment)]
 
@@ -357,10 +364,14 @@ class configuration:
       self.fp_precision = ['double', 'single']
 
     # If the user wishes to compile using debug mode, append the debugging
-    # flag to all lists of compiler flags for all distribution types
+    # flag to all lists of compiler flags for all distribution types and
+    # report the heap allocations made in the transport sweeps
     if self.debug_mode:
       for k in self.compiler_flags:
         self.compiler_flags[k].append('-g')
+      for cc in ['gcc', 'icpc', 'bgxlc']:
+        for fp in self.macros[cc]:
+          self.macros[cc][fp].append(('COUNT_ALLOCATIONS', None))
 
     # If the user wishes to compile using profile mode, append the profiling
     # flag to all lists of compiler flags for all distribution types
@@ -369,6 +380,14 @@ class configuration:
         self.compiler_flags[k].append('-pg')
         self.compiler_flags[k].append('-g')
 
+    # If the user wishes to compile with PAPI instrumentation, define the
+    # PAPI macro and link the PAPI library for all CPU compilers
+    if self.with_papi:
+      for cc in ['gcc', 'icpc', 'bgxlc']:
+        self.shared_libraries[cc].append('papi')
+        for fp in self.macros[cc]:
+          self.macros[cc][fp].append(('PAPI', None))
+
     # If the user passed in the --no-numpy flag, tell SWIG not to embed
     # NumPy typemaps in the source code
     if not self.with_numpy:
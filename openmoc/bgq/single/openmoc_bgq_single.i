@@ -11,6 +11,7 @@
   #include "../../../src/Quadrature.h"
   #include "../../../src/Solver.h"
   #include "../../../src/CPUSolver.h"
+  #include "../../../src/ThreadPrivateSolver.h"
   #include "../../../src/Surface.h"
   #include "../../../src/Timer.h"
   #include "../../../src/Track.h"
@@ -187,6 +188,12 @@
  * openmoc.process */
 %apply (double* ARGOUT_ARRAY1, int DIM1) {(double* fission_rates, int num_FSRs)}
 
+/* The typemaps used to match the method signatures for the Solver's
+ * getters for the history of each source iteration */
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* keffs, int num_iterations)}
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* residuals, int num_iterations)}
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* phase_times, int num_values)}
+
 /* The typemap used to match the method signature for the Universe's
  * getCellIds method for the data processing routines in openmoc.process */
 %apply (int* ARGOUT_ARRAY1, int DIM1) {(int* cell_ids, int num_cells)}
@@ -204,6 +211,7 @@
 %include ../../../src/Quadrature.h
 %include ../../../src/Solver.h
 %include ../../../src/CPUSolver.h
+%include ../../../src/ThreadPrivateSolver.h
 %include ../../../src/Surface.h
 %include ../../../src/Timer.h
 %include ../../../src/Track.h
@@ -46,6 +46,12 @@
  * openmoc.process */
 %apply (double* ARGOUT_ARRAY1, int DIM1) {(double* fission_rates, int num_FSRs)}
 
+/* The typemaps used to match the method signatures for the Solver's
+ * getters for the history of each source iteration */
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* keffs, int num_iterations)}
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* residuals, int num_iterations)}
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* phase_times, int num_values)}
+
 
 #endif
 
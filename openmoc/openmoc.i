@@ -16,6 +16,7 @@
   #include "../src/Quadrature.h"
   #include "../src/Solver.h"
   #include "../src/CPUSolver.h"
+  #include "../src/ThreadPrivateSolver.h"
   #include "../src/Surface.h"
   #include "../src/Timer.h"
   #include "../src/Track.h"
@@ -23,8 +24,9 @@
   #include "../src/Universe.h"
   #include "../src/Cmfd.h"
 
-  #ifdef ICPC
+  #if defined(INTEL) || defined(GNU)
   #include "../src/VectorizedSolver.h"
+  #include "../src/VectorizedPrivateSolver.h"
   #endif
 
   #define printf PySys_WriteStdout
@@ -261,6 +263,12 @@
  * getCellIds method for the data processing routines in openmoc.process */
 %apply (int* ARGOUT_ARRAY1, int DIM1) {(int* cell_ids, int num_cells)}
 
+/* The typemaps used to match the method signatures for the Solver's
+ * getters for the history of each source iteration */
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* keffs, int num_iterations)}
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* residuals, int num_iterations)}
+%apply (double* ARGOUT_ARRAY1, int DIM1) {(double* phase_times, int num_values)}
+
 #endif
 
 
@@ -415,6 +423,7 @@
 %include ../src/Quadrature.h
 %include ../src/Solver.h
 %include ../src/CPUSolver.h
+%include ../src/ThreadPrivateSolver.h
 %include ../src/Surface.h
 %include ../src/Timer.h
 %include ../src/Track.h
@@ -422,8 +431,9 @@
 %include ../src/Universe.h
 %include ../src/Cmfd.h
 
-#ifdef ICPC
+#if defined(ICPC) || defined(GCC)
 %include "../src/VectorizedSolver.h"
+%include "../src/VectorizedPrivateSolver.h"
 #endif
 
 #define printf PySys_WriteStdout
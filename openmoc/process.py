@@ -166,6 +166,33 @@ def compute_fission_rates(solver, use_hdf5=False):
     # Pickle the fission rates to a file
     pickle.dump(fission_rates_sum, open(directory + filename + '.pkl', 'wb'))
 
+##
+# @brief Returns the k_eff, source residual and phase times for each source
+#        iteration of a Solver as NumPy arrays.
+# @details The phase times are a 2D array indexed by iteration and by phase.
+#          This method may be called as follows:
+#
+# @code
+#          history = openmoc.process.get_iteration_history(solver)
+#          sweep_times = history['phase times'][:,openmoc.PHASE_TRANSPORT_SWEEP]
+# @endcode
+#
+# @param solver a Solver which has converged the source
+# @return a dictionary of the history arrays and phase names
+def get_iteration_history(solver):
+
+  num_iters = solver.getNumIterations()
+  num_phases = openmoc.NUM_SOLVER_PHASES
+
+  history = {}
+  history['keff'] = solver.getKeffHistory(num_iters)
+  history['residual'] = solver.getResidualHistory(num_iters)
+  history['phase times'] = \
+      solver.getPhaseTimeHistory(num_iters * num_phases).reshape(-1, num_phases)
+  history['phase names'] = [solver.getPhaseName(i) for i in range(num_phases)]
+
+  return history
+
 ##
 # @brief This method stores all of the data for an OpenMOC simulation to a
 #        a binary file for downstream data processing.
@@ -242,10 +269,12 @@ def store_simulation_state(solver, fluxes=False, sources=False,
   else:
     precision = 'single'
 
-  # Determine whether we are using the exponential intrinsic or
-  # linear interpolation for exponential evaluations
+  # Determine whether we are using the exponential intrinsic, the rational
+  # approximation or linear interpolation for exponential evaluations
   if solver.isUsingExponentialIntrinsic():
       method = 'exp intrinsic'
+  elif solver.isUsingExponentialRational():
+      method = 'rational approximation'
   else:
     method = 'linear interpolation'
 
@@ -45,7 +45,8 @@ class custom_install(install):
     ('with-bgxlc', None, "Build openmoc.bgxlc modules using IBM compiler"),
     ('with-sp', None, "Build modules with single precision"),
     ('with-dp', None, "Build modules with double precision"),
-    ('debug-mode', None, "Build with debugging symbols"),
+    ('debug-mode', None, "Build with debugging symbols and heap "
+                   "allocation counts"),
     ('profile-mode', None, "Build with profiling symbols"),
     ('with-ccache', None, "Build with ccache for rapid recompilation"),
     ('with-papi', None, 'Build modules with PAPI instrumentation'),
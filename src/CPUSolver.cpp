@@ -17,6 +17,57 @@ CPUSolver::CPUSolver(Geometry* geometry, TrackGenerator* track_generator)
 
   _FSR_locks = NULL;
   _cmfd_surface_locks = NULL;
+  _thread_fsr_flux = NULL;
+  _segment_sigma_t = NULL;
+  _flux_update_type = FLUX_UPDATE_LOCKS;
+  _store_exponentials = false;
+  _exponentials_memory_budget = 1000.;
+  _exponentials = NULL;
+  _thread_segment_exponentials = NULL;
+  _segment_kernel = NULL;
+  _exp_table_single = NULL;
+  _exp_table_double = NULL;
+  _store_tau_indices = false;
+  _tau_indices = NULL;
+  _interpolate_exponentials = NULL;
+
+  _num_source_materials = 0;
+  _source_materials = NULL;
+  _scatter_band_start = NULL;
+  _scatter_band_end = NULL;
+  _scatter_totals = NULL;
+  _num_source_batches = 0;
+  _source_batch_offsets = NULL;
+  _source_batch_materials = NULL;
+  _source_batch_FSRs = NULL;
+  _FSR_rates = NULL;
+  _group_rates = NULL;
+
+  _segment_fluxes = NULL;
+  _segment_currents = NULL;
+  _FSR_contribution_offsets = NULL;
+  _FSR_contributions = NULL;
+  _surface_contribution_offsets = NULL;
+  _surface_contributions = NULL;
+  _reproducible_memory_budget = 2000.;
+  _max_contributions = 0;
+  _thread_contributions = NULL;
+
+  _sweep_type = SWEEP_HALFSPACES;
+  _old_boundary_flux = NULL;
+  _boundary_flux_precision = BOUNDARY_FLUX_FULL;
+  _packed_boundary_flux = NULL;
+  _old_packed_boundary_flux = NULL;
+  _boundary_flux_swapped = false;
+  _boundary_flux_sources = NULL;
+  _boundary_flux_scale = 1.0;
+  _thread_boundary_flux = NULL;
+  _num_track_chunks = 0;
+  _track_chunk_offsets = NULL;
+  _thread_sweep_times = NULL;
+  _thread_sweep_segments = NULL;
+  _thread_leakage = NULL;
+  _track_leakage = NULL;
 }
 
 
@@ -35,6 +86,107 @@ CPUSolver::~CPUSolver() {
 
   if (_surface_currents != NULL)
     delete [] _surface_currents;
+
+  if (_thread_fsr_flux != NULL)
+    delete [] _thread_fsr_flux;
+
+  if (_segment_sigma_t != NULL)
+    delete [] _segment_sigma_t;
+
+  if (_exponentials != NULL)
+    delete [] _exponentials;
+
+  if (_source_materials != NULL)
+    delete [] _source_materials;
+
+  if (_scatter_band_start != NULL)
+    delete [] _scatter_band_start;
+
+  if (_scatter_band_end != NULL)
+    delete [] _scatter_band_end;
+
+  if (_scatter_totals != NULL)
+    delete [] _scatter_totals;
+
+  if (_source_batch_offsets != NULL)
+    delete [] _source_batch_offsets;
+
+  if (_source_batch_materials != NULL)
+    delete [] _source_batch_materials;
+
+  if (_source_batch_FSRs != NULL)
+    delete [] _source_batch_FSRs;
+
+  if (_FSR_rates != NULL)
+    delete [] _FSR_rates;
+
+  if (_group_rates != NULL)
+    delete [] _group_rates;
+
+  if (_segment_fluxes != NULL)
+    delete [] _segment_fluxes;
+
+  if (_segment_currents != NULL)
+    delete [] _segment_currents;
+
+  if (_FSR_contribution_offsets != NULL)
+    delete [] _FSR_contribution_offsets;
+
+  if (_FSR_contributions != NULL)
+    delete [] _FSR_contributions;
+
+  if (_surface_contribution_offsets != NULL)
+    delete [] _surface_contribution_offsets;
+
+  if (_surface_contributions != NULL)
+    delete [] _surface_contributions;
+
+  if (_thread_contributions != NULL)
+    delete [] _thread_contributions;
+
+  restoreBoundaryFluxBuffers();
+
+  if (_old_boundary_flux != NULL)
+    delete [] _old_boundary_flux;
+
+  if (_packed_boundary_flux != NULL)
+    delete [] _packed_boundary_flux;
+
+  if (_old_packed_boundary_flux != NULL)
+    delete [] _old_packed_boundary_flux;
+
+  if (_boundary_flux_sources != NULL)
+    delete [] _boundary_flux_sources;
+
+  if (_thread_boundary_flux != NULL)
+    delete [] _thread_boundary_flux;
+
+  if (_track_chunk_offsets != NULL)
+    delete [] _track_chunk_offsets;
+
+  if (_thread_sweep_times != NULL)
+    delete [] _thread_sweep_times;
+
+  if (_thread_sweep_segments != NULL)
+    delete [] _thread_sweep_segments;
+
+  if (_thread_leakage != NULL)
+    delete [] _thread_leakage;
+
+  if (_track_leakage != NULL)
+    delete [] _track_leakage;
+
+  if (_thread_segment_exponentials != NULL)
+    delete [] _thread_segment_exponentials;
+
+  if (_exp_table_single != NULL)
+    delete [] _exp_table_single;
+
+  if (_exp_table_double != NULL)
+    delete [] _exp_table_double;
+
+  if (_tau_indices != NULL)
+    delete [] _tau_indices;
 }
 
 
@@ -47,6 +199,117 @@ int CPUSolver::getNumThreads() {
 }
 
 
+/**
+ * @brief Returns the synchronization used for FSR scalar flux updates.
+ * @return the flux update type (FLUX_UPDATE_LOCKS or FLUX_UPDATE_ATOMIC)
+ */
+fluxUpdateType CPUSolver::getFluxUpdateType() {
+  return _flux_update_type;
+}
+
+
+/**
+ * @brief Returns the order in which Tracks are swept.
+ * @return the sweep type (SWEEP_HALFSPACES or SWEEP_DOUBLE_BUFFERED)
+ */
+sweepType CPUSolver::getSweepType() {
+  return _sweep_type;
+}
+
+
+/**
+ * @brief Returns the precision in which the boundary angular fluxes are
+ *        stored.
+ * @return the boundary flux precision (BOUNDARY_FLUX_FULL,
+ *         BOUNDARY_FLUX_FP16 or BOUNDARY_FLUX_BF16)
+ */
+boundaryFluxPrecision CPUSolver::getBoundaryFluxPrecision() {
+  return _boundary_flux_precision;
+}
+
+
+/**
+ * @brief Returns whether the exponentials for each segment are stored.
+ * @details This is false if stored exponentials were not requested, or
+ *          if they would have exceeded the memory budget, or if they have
+ *          not yet been computed for the current simulation.
+ * @return true if the exponentials are stored; false otherwise
+ */
+bool CPUSolver::isStoringExponentials() {
+  return (_exponentials != NULL);
+}
+
+
+/**
+ * @brief Returns whether the exponential table index for each segment and
+ *        energy group is stored.
+ * @details This is false if stored tau indices were not requested, or if
+ *          they were not needed or did not fit in 16 bits, or if they have
+ *          not yet been computed for the current simulation.
+ * @return true if the tau indices are stored; false otherwise
+ */
+bool CPUSolver::isStoringTauIndices() {
+  return (_tau_indices != NULL);
+}
+
+
+/**
+ * @brief Returns the maximum memory (MB) which may be used to store
+ *        exponentials.
+ * @return the memory budget for stored exponentials (MB)
+ */
+double CPUSolver::getExponentialsMemoryBudget() {
+  return _exponentials_memory_budget;
+}
+
+
+/**
+ * @brief Returns the maximum memory (MB) which may be used for reproducible
+ *        flux updates.
+ * @return the memory budget for reproducible flux updates (MB)
+ */
+double CPUSolver::getReproducibleMemoryBudget() {
+  return _reproducible_memory_budget;
+}
+
+
+/**
+ * @brief Returns the number of Track chunks in each azimuthal halfspace.
+ * @return the number of Track chunks per halfspace
+ */
+int CPUSolver::getNumTrackChunks() {
+  return _num_track_chunks;
+}
+
+
+/**
+ * @brief Returns the load imbalance between threads in the transport sweep.
+ * @details The load imbalance is the ratio of the maximum to the mean time
+ *          spent by each thread sweeping Tracks in all transport sweeps
+ *          since the source was last converged. A perfectly balanced sweep
+ *          has a load imbalance of 1.
+ * @return the ratio of the maximum to mean thread sweep time
+ */
+double CPUSolver::getLoadImbalance() {
+
+  if (_thread_sweep_times == NULL)
+    return 1.;
+
+  double max_time = 0.;
+  double mean_time = 0.;
+
+  for (int t=0; t < _num_threads; t++) {
+    max_time = std::max(max_time, _thread_sweep_times[t]);
+    mean_time += _thread_sweep_times[t] / _num_threads;
+  }
+
+  if (mean_time == 0.)
+    return 1.;
+
+  return max_time / mean_time;
+}
+
+
 /**
  * @brief Returns the scalar flux for some FSR and energy group.
  * @param fsr_id the ID for the FSR of interest
@@ -184,35 +447,219 @@ void CPUSolver::setNumThreads(int num_threads) {
 }
 
 
+/**
+ * @brief Sets the synchronization used for FSR scalar flux and Cmfd Mesh
+ *        surface current updates in the transport sweep.
+ * @details The default FLUX_UPDATE_LOCKS type acquires an OpenMP mutual
+ *          exclusion lock for each segment's FSR, while the
+ *          FLUX_UPDATE_ATOMIC type uses lock-free atomic additions for
+ *          each energy group and does not allocate any locks. The two
+ *          types give the same fluxes to within floating point round-off.
+ *          The FLUX_UPDATE_REPRODUCIBLE type stores the contribution from
+ *          each segment and reduces them for each FSR and surface with a
+ *          pairwise sum in a fixed order after each transport sweep. This
+ *          gives bitwise identical fluxes and eigenvalues for any number
+ *          of threads at the cost of memory for each segment and energy
+ *          group. This may be called from Python as follows:
+ *
+ * @code
+ *          solver.setFluxUpdateType(openmoc.FLUX_UPDATE_ATOMIC)
+ * @endcode
+ *
+ * @param flux_update_type the flux update type
+ */
+void CPUSolver::setFluxUpdateType(fluxUpdateType flux_update_type) {
+
+  if (flux_update_type != FLUX_UPDATE_LOCKS &&
+      flux_update_type != FLUX_UPDATE_ATOMIC &&
+      flux_update_type != FLUX_UPDATE_REPRODUCIBLE)
+    log_printf(ERROR, "Unable to set the flux update type to %d since it "
+               "is not a supported type", flux_update_type);
+
+  _flux_update_type = flux_update_type;
+}
+
+
+/**
+ * @brief Sets the order in which Tracks are swept in the transport sweep.
+ * @details The default SWEEP_HALFSPACES type sweeps the Tracks in each
+ *          azimuthal halfspace in turn with a synchronization between them
+ *          such that the reflected boundary fluxes do not race. The
+ *          SWEEP_DOUBLE_BUFFERED type swaps two boundary flux buffers
+ *          before each sweep and sweeps all Tracks in a single parallel
+ *          loop, writing the outgoing boundary fluxes to the other buffer.
+ *          This removes one synchronization per sweep and the idle threads
+ *          at the end of the first halfspace, but the boundary fluxes lag
+ *          by one sweep which may require more source iterations to
+ *          converge. A cyclic sweep type is not offered since it requires
+ *          more source iterations (see sweepType). This may be called from
+ *          Python as follows:
+ *
+ * @code
+ *          solver.setSweepType(openmoc.SWEEP_DOUBLE_BUFFERED)
+ * @endcode
+ *
+ * @param sweep_type the sweep type
+ */
+void CPUSolver::setSweepType(sweepType sweep_type) {
+
+  if (sweep_type != SWEEP_HALFSPACES && sweep_type != SWEEP_DOUBLE_BUFFERED)
+    log_printf(ERROR, "Unable to set the sweep type to %d since it is not "
+               "a supported type", sweep_type);
+
+  _sweep_type = sweep_type;
+}
+
+
+/**
+ * @brief Sets the precision in which the boundary angular fluxes are
+ *        stored between transport sweeps.
+ * @details The BOUNDARY_FLUX_FULL precision (default) stores the incoming
+ *          flux and the leakage for each Track direction in FP_PRECISION.
+ *          The BOUNDARY_FLUX_FP16 and BOUNDARY_FLUX_BF16 precisions only
+ *          store the outgoing flux for each Track direction in 16 bits,
+ *          from which both the incoming flux for the next Track and the
+ *          leakage through vacuum boundaries are found. This reduces the
+ *          boundary flux memory by a factor of four in single precision
+ *          and eight in double precision. The angular fluxes are unpacked
+ *          into FP_PRECISION for each Track direction such that the
+ *          transport sweep still accumulates in FP_PRECISION. The packed
+ *          fluxes are scaled by a power of two before each sweep such that
+ *          they may not overflow FP16, which is more precise than BF16 but
+ *          may underflow for fluxes far below the largest flux. The
+ *          rounding of the packed fluxes limits the source convergence
+ *          threshold which may be reached in a reasonable number of
+ *          iterations to roughly 1E-8 for FP16 and 1E-6 for BF16. Reduced
+ *          precision boundary fluxes may not be used with Cmfd
+ *          acceleration. This may be called from Python as follows:
+ *
+ * @code
+ *          solver.setBoundaryFluxPrecision(openmoc.BOUNDARY_FLUX_FP16)
+ * @endcode
+ *
+ * @param precision the boundary flux precision
+ */
+void CPUSolver::setBoundaryFluxPrecision(boundaryFluxPrecision precision) {
+
+  if (precision != BOUNDARY_FLUX_FULL && precision != BOUNDARY_FLUX_FP16 &&
+      precision != BOUNDARY_FLUX_BF16)
+    log_printf(ERROR, "Unable to set the boundary flux precision to %d "
+               "since it is not a supported precision", precision);
+
+  _boundary_flux_precision = precision;
+}
+
+
+/**
+ * @brief Sets whether to precompute and store the exponentials for each
+ *        segment, polar angle and energy group.
+ * @details Since the optical length of each segment is the same for every
+ *          source iteration, the exponentials may be evaluated once before
+ *          the first transport sweep and reused in each subsequent sweep.
+ *          This requires memory for each segment, polar angle and energy
+ *          group. The exponentials are computed on-the-fly if the memory
+ *          exceeds the budget set by CPUSolver::setExponentialsMemoryBudget().
+ * @param store_exponentials whether to store exponentials (false by default)
+ */
+void CPUSolver::setStoreExponentials(bool store_exponentials) {
+  _store_exponentials = store_exponentials;
+}
+
+
+/**
+ * @brief Sets whether to precompute and store the exponential table index
+ *        for each segment and energy group.
+ * @details The table index of a segment's optical length in each energy
+ *          group is the same for every polar angle and source iteration.
+ *          If the indices are stored, the table lookups in each transport
+ *          sweep do not need to round the optical lengths to the nearest
+ *          table index. The indices are stored in 16 bits, which requires
+ *          far less memory than the exponentials for each polar angle. The
+ *          indices are only used with the linear interpolation table when
+ *          the exponentials are not stored, and are computed on-the-fly if
+ *          the table has more than 65536 values.
+ * @param store_tau_indices whether to store tau indices (false by default)
+ */
+void CPUSolver::setStoreTauIndices(bool store_tau_indices) {
+  _store_tau_indices = store_tau_indices;
+}
+
+
+/**
+ * @brief Sets the maximum memory (MB) which may be used to store the
+ *        exponentials for each segment, polar angle and energy group.
+ * @param memory_budget the memory budget in MB (1000 MB by default)
+ */
+void CPUSolver::setExponentialsMemoryBudget(double memory_budget) {
+
+  if (memory_budget < 0.)
+    log_printf(ERROR, "Unable to set the memory budget for stored "
+               "exponentials to %f MB since it is negative", memory_budget);
+
+  _exponentials_memory_budget = memory_budget;
+}
+
+
+/**
+ * @brief Sets the maximum memory (MB) which may be used to store the
+ *        segment contributions for reproducible flux updates.
+ * @details Reproducible flux updates store the contribution of each segment
+ *          in each direction and energy group to its FSR's scalar flux, and
+ *          to its Cmfd Mesh surface's current if CMFD is used. If this
+ *          exceeds the budget, the Solver reports an error since the
+ *          contributions cannot be reduced in a fixed order without them.
+ * @param memory_budget the memory budget in MB (2000 MB by default)
+ */
+void CPUSolver::setReproducibleMemoryBudget(double memory_budget) {
+
+  if (memory_budget < 0.)
+    log_printf(ERROR, "Unable to set the memory budget for reproducible "
+               "flux updates to %f MB since it is negative", memory_budget);
+
+  _reproducible_memory_budget = memory_budget;
+}
+
+
 /**
  * @brief Allocates memory for Track boundary angular flux and leakage
  *        and FSR scalar flux arrays.
  * @details Deletes memory for old flux arrays if they were allocated for a
- *          previous simulation.
+ *          previous simulation. This method also allocates the scratch
+ *          buffers used by each thread in the transport sweep such that
+ *          the sweep itself does not allocate any memory.
  */
 void CPUSolver::initializeFluxArrays() {
 
+  restoreBoundaryFluxBuffers();
+
   /* Delete old flux arrays if they exist */
   if (_boundary_flux != NULL)
     delete [] _boundary_flux;
 
-  if (_boundary_leakage != NULL)
-    delete [] _boundary_leakage;
-
   if (_scalar_flux != NULL)
     delete [] _scalar_flux;
 
+  if (_thread_fsr_flux != NULL)
+    delete [] _thread_fsr_flux;
+
   int size;
 
-  /* Allocate memory for the Track boundary flux and leakage arrays */
+  _boundary_flux = NULL;
+
+  /* Allocate memory for the Track boundary flux array */
   try{
     size = 2 * _tot_num_tracks * _polar_times_groups;
-    _boundary_flux = new FP_PRECISION[size];
-    _boundary_leakage = new FP_PRECISION[size];
+
+    if (_boundary_flux_precision == BOUNDARY_FLUX_FULL)
+      _boundary_flux = new FP_PRECISION[size];
 
     /* Allocate an array for the FSR scalar flux */
     size = _num_FSRs * _num_groups;
     _scalar_flux = new FP_PRECISION[size];
+
+    /* Allocate a scratch buffer for each thread for the transport sweep */
+    size = _num_threads * _num_groups;
+    _thread_fsr_flux = new FP_PRECISION[size];
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the Solver's fluxes. "
@@ -233,9 +680,6 @@ void CPUSolver::initializeSourceArrays() {
   if (_fission_sources != NULL)
     delete [] _fission_sources;
 
-  if (_scatter_sources != NULL)
-    delete [] _scatter_sources;
-
   if (_old_fission_sources != NULL)
     delete [] _old_fission_sources;
 
@@ -245,6 +689,12 @@ void CPUSolver::initializeSourceArrays() {
   if (_source_residuals != NULL)
     delete [] _source_residuals;
 
+  if (_FSR_rates != NULL)
+    delete [] _FSR_rates;
+
+  if (_group_rates != NULL)
+    delete [] _group_rates;
+
   int size;
 
   /* Allocate memory for all source arrays */
@@ -254,13 +704,16 @@ void CPUSolver::initializeSourceArrays() {
     _fission_sources = new FP_PRECISION[size];
     _reduced_sources = new FP_PRECISION[size];
 
-    size = _num_threads * _num_groups;
-    _scatter_sources = new FP_PRECISION[size];
-
     size = _num_FSRs;
     _old_fission_sources = new FP_PRECISION[size];
     _source_residuals = new FP_PRECISION[size];
 
+    size = 3 * _num_FSRs;
+    _FSR_rates = new FP_PRECISION[size];
+
+    size = 3 * _num_threads * _num_groups;
+    _group_rates = new FP_PRECISION[size];
+
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the solver's FSR "
@@ -311,46 +764,66 @@ void CPUSolver::buildExpInterpTable() {
       _polar_weights(i,p) = azim_weight*_quad->getMultiple(p)*FOUR_PI;
   }
 
-  /* Find largest optical path length track segment */
-  FP_PRECISION tau = _track_generator->getMaxOpticalLength();
+  /* Delete the old tables if they exist */
+  if (_exp_table_single != NULL) {
+    delete [] _exp_table_single;
+    _exp_table_single = NULL;
+  }
+
+  if (_exp_table_double != NULL) {
+    delete [] _exp_table_double;
+    _exp_table_double = NULL;
+  }
 
-  /* Expand tau slightly to accomodate track segments which have a
-   * length very nearly equal to the maximum value */
-  tau *= 1.01;
+  /* Size the table for the convergence threshold or the cache level */
+  int entry_size;
+  if (_exp_table_precision == EXP_TABLE_SINGLE)
+    entry_size = sizeof(float);
+  else
+    entry_size = sizeof(double);
 
-  /* Set size of interpolation table */
-  int num_array_values = tau * sqrt(1./(8.*_source_convergence_thresh*1e-2));
-  _exp_table_spacing = tau / num_array_values;
-  _exp_table_size = _two_times_num_polar * num_array_values;
-  _exp_table_max_index = _exp_table_size - _two_times_num_polar - 1.;
+  int num_array_values = initializeExpTableSpacing(entry_size,
+                                                   _exp_table_cache_level);
 
   log_printf(DEBUG, "Exponential interpolation table size: %i, max index: %i",
              _exp_table_size, _exp_table_max_index);
 
-  /* Allocate array for the table */
-  if (_exp_table != NULL)
-    delete [] _exp_table;
-
-  _exp_table = new FP_PRECISION[_exp_table_size];
+  /* Allocate array for the table and select the interpolation in its
+   * precision once rather than for each exponential */
+  if (_exp_table_precision == EXP_TABLE_SINGLE) {
+    _exp_table_single = new float[_exp_table_size];
+    _interpolate_exponentials = &CPUSolver::interpolateExponentials<float>;
+  }
+  else {
+    _exp_table_double = new double[_exp_table_size];
+    _interpolate_exponentials = &CPUSolver::interpolateExponentials<double>;
+  }
 
-  FP_PRECISION expon;
-  FP_PRECISION intercept;
-  FP_PRECISION slope;
+  double expon;
+  double intercept;
+  double slope;
+  double sintheta;
 
-  /* Create exponential linear interpolation table */
+  /* Create exponential linear interpolation table with the slopes and
+   * intercepts for all polar angles interleaved for each optical length */
   for (int i=0; i < num_array_values; i ++){
     for (int p=0; p < _num_polar; p++){
-      expon = exp(- (i * _exp_table_spacing) / _quad->getSinTheta(p));
-      slope = - expon / _quad->getSinTheta(p);
-      intercept = expon * (1 + (i * _exp_table_spacing)/_quad->getSinTheta(p));
-      _exp_table[_two_times_num_polar * i + 2 * p] = slope;
-      _exp_table[_two_times_num_polar * i + 2 * p + 1] = intercept;
+      sintheta = _quad->getSinTheta(p);
+      expon = exp(- (i * _exp_table_spacing) / sintheta);
+      slope = - expon / sintheta;
+      intercept = expon * (1 + (i * _exp_table_spacing) / sintheta);
+
+      if (_exp_table_single != NULL) {
+        _exp_table_single[_two_times_num_polar * i + 2 * p] = slope;
+        _exp_table_single[_two_times_num_polar * i + 2 * p + 1] = intercept;
+      }
+      else {
+        _exp_table_double[_two_times_num_polar * i + 2 * p] = slope;
+        _exp_table_double[_two_times_num_polar * i + 2 * p + 1] = intercept;
+      }
     }
   }
 
-  /* Compute the reciprocal of the table entry spacing */
-  _inverse_exp_table_spacing = 1.0 / _exp_table_spacing;
-
   return;
 }
 
@@ -372,30 +845,31 @@ void CPUSolver::initializeFSRs() {
   if (_FSR_materials != NULL)
     delete [] _FSR_materials;
 
+  if (_FSR_locks != NULL) {
+    delete [] _FSR_locks;
+    _FSR_locks = NULL;
+  }
+
   _FSR_volumes = (FP_PRECISION*)calloc(_num_FSRs, sizeof(FP_PRECISION));
   _FSR_materials = new Material*[_num_FSRs];
-  _FSR_locks = new omp_lock_t[_num_FSRs];
 
-  int num_segments;
-  segment* curr_segment;
-  segment* segments;
+  int start_segment, end_segment;
   FP_PRECISION volume;
   Material* material;
   Universe* root_universe = _geometry->getRootUniverse();
   _num_fissionable_FSRs = 0;
 
   /* Set each FSR's "volume" by accumulating the total length of all Tracks
-   * inside the FSR. Loop over azimuthal angles, Tracks and Track segments. */
+   * inside the FSR. Loop over Tracks and the flat Track segment arrays. */
   for (int i=0; i < _tot_num_tracks; i++) {
 
     int azim_index = _tracks[i]->getAzimAngleIndex();
-    num_segments = _tracks[i]->getNumSegments();
-    segments = _tracks[i]->getSegments();
+    start_segment = _segment_offsets[i];
+    end_segment = _segment_offsets[i+1];
 
-    for (int s=0; s < num_segments; s++) {
-      curr_segment = &segments[s];
-      volume = curr_segment->_length * _azim_weights[azim_index];
-      _FSR_volumes[curr_segment->_region_id] += volume;
+    for (int s=start_segment; s < end_segment; s++) {
+      volume = _segment_lengths[s] * _azim_weights[azim_index];
+      _FSR_volumes[_segment_fsr_ids[s]] += volume;
     }
   }
 
@@ -417,10 +891,784 @@ void CPUSolver::initializeFSRs() {
                _FSR_volumes[r]);
   }
 
-  /* Loop over all FSRs to initialize OpenMP locks */
+  /* Retrieve the total cross-sections for each segment Material index */
+  if (_segment_sigma_t != NULL)
+    delete [] _segment_sigma_t;
+
+  int num_segment_materials = _track_generator->getNumSegmentMaterials();
+  Material** segment_materials = _track_generator->getSegmentMaterials();
+  _segment_sigma_t = new FP_PRECISION*[num_segment_materials];
+
+  for (int m=0; m < num_segment_materials; m++)
+    _segment_sigma_t[m] = segment_materials[m]->getSigmaT();
+
+  initializeSourceBatches();
+  initializeExponentials();
+  initializeTauIndices();
+  initializeSegmentKernel();
+  initializeContributions();
+  initializeTrackChunks();
+  initializePackedBoundaryFluxes();
+  initializeBoundaryFluxBuffer();
+  initializeLeakageTallies();
+
+  /* Atomic flux updates do not need any locks */
+  if (_flux_update_type == FLUX_UPDATE_ATOMIC) {
+    log_printf(INFO, "FSR scalar flux updates use atomic additions which "
+               "require 0.00 MB of memory");
+    return;
+  }
+
+  /* Reproducible flux updates do not need any locks */
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE)
+    return;
+
+  _FSR_locks = new omp_lock_t[_num_FSRs];
+
+  log_printf(INFO, "FSR scalar flux updates use mutual exclusion locks which "
+             "require %.2f MB of memory",
+             _num_FSRs * sizeof(omp_lock_t) / 1.E6);
+
+  /* Loop over all FSRs to initialize OpenMP locks */
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++)
+    omp_init_lock(&_FSR_locks[r]);
+
+  return;
+}
+
+
+/**
+ * @brief Splits the Tracks in each azimuthal halfspace into chunks of
+ *        consecutive Tracks with approximately equal cost.
+ * @details The cost of each Track is modeled as its number of segments plus
+ *          a fixed overhead for the boundary flux transfer. Each halfspace
+ *          is split into TRACK_CHUNKS_PER_THREAD chunks per thread which
+ *          are scheduled dynamically in the transport sweep. Consecutive
+ *          Tracks share azimuthal angles and cross neighboring FSRs, which
+ *          improves cache reuse compared to scheduling individual Tracks.
+ */
+void CPUSolver::initializeTrackChunks() {
+
+  /* Delete old Track chunk arrays if they exist */
+  if (_track_chunk_offsets != NULL)
+    delete [] _track_chunk_offsets;
+
+  if (_thread_sweep_times != NULL)
+    delete [] _thread_sweep_times;
+
+  if (_thread_sweep_segments != NULL)
+    delete [] _thread_sweep_segments;
+
+  int* num_segments = _track_generator->getNumSegmentsArray();
+  int num_halfspace_tracks = _tot_num_tracks / 2;
+
+  _num_track_chunks = std::min(_num_threads * TRACK_CHUNKS_PER_THREAD,
+                               std::max(num_halfspace_tracks, 1));
+  _track_chunk_offsets = new int[2*_num_track_chunks+1];
+
+  _thread_sweep_times = new double[_num_threads];
+  _thread_sweep_segments = new long[_num_threads];
+
+  for (int t=0; t < _num_threads; t++) {
+    _thread_sweep_times[t] = 0.;
+    _thread_sweep_segments[t] = 0;
+  }
+
+  double max_chunk_cost = 0.;
+  double mean_chunk_cost = 0.;
+
+  /* Loop over azimuthal angle halfspaces */
+  for (int i=0; i < 2; i++) {
+
+    int min_track = i * num_halfspace_tracks;
+    int max_track = (i + 1) * num_halfspace_tracks;
+    int* chunk_offsets = &_track_chunk_offsets[i*_num_track_chunks];
+
+    /* Compute the total cost of the Tracks in this halfspace */
+    double tot_cost = 0.;
+    for (int t=min_track; t < max_track; t++)
+      tot_cost += num_segments[t] + TRACK_COST_OVERHEAD;
+
+    /* Start a new chunk each time the cumulative cost passes a multiple of
+     * the target chunk cost */
+    double chunk_cost = tot_cost / _num_track_chunks;
+    double cost = 0.;
+    double chunk_start_cost = 0.;
+    int chunk = 0;
+
+    chunk_offsets[0] = min_track;
+
+    for (int t=min_track; t < max_track; t++) {
+
+      while (chunk < _num_track_chunks - 1 && cost >= (chunk+1) * chunk_cost) {
+        chunk++;
+        chunk_offsets[chunk] = t;
+        max_chunk_cost = std::max(max_chunk_cost, cost - chunk_start_cost);
+        chunk_start_cost = cost;
+      }
+
+      cost += num_segments[t] + TRACK_COST_OVERHEAD;
+    }
+
+    /* Any remaining chunks are empty */
+    while (chunk < _num_track_chunks - 1) {
+      chunk++;
+      chunk_offsets[chunk] = max_track;
+    }
+
+    max_chunk_cost = std::max(max_chunk_cost, cost - chunk_start_cost);
+    mean_chunk_cost += tot_cost / (2 * _num_track_chunks);
+  }
+
+  _track_chunk_offsets[2*_num_track_chunks] = 2 * num_halfspace_tracks;
+
+  log_printf(INFO, "Split the Tracks into %d chunks per halfspace with a "
+             "maximum to mean chunk cost of %.3f", _num_track_chunks,
+             max_chunk_cost / std::max(mean_chunk_cost, 1.));
+}
+
+
+/**
+ * @brief Allocates the copy of the incoming boundary fluxes for the double
+ *        buffered sweep.
+ */
+void CPUSolver::initializeBoundaryFluxBuffer() {
+
+  restoreBoundaryFluxBuffers();
+
+  /* Delete old boundary flux buffers if they exist */
+  if (_old_boundary_flux != NULL) {
+    delete [] _old_boundary_flux;
+    _old_boundary_flux = NULL;
+  }
+
+  if (_old_packed_boundary_flux != NULL) {
+    delete [] _old_packed_boundary_flux;
+    _old_packed_boundary_flux = NULL;
+  }
+
+  if (_sweep_type != SWEEP_DOUBLE_BUFFERED)
+    return;
+
+  long size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+  bool full = (_boundary_flux_precision == BOUNDARY_FLUX_FULL);
+  double memory = size * (full ? sizeof(FP_PRECISION) : sizeof(uint16_t))
+                  / 1.E6;
+
+  try{
+    if (full)
+      _old_boundary_flux = new FP_PRECISION[size];
+    else
+      _old_packed_boundary_flux = new uint16_t[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the double buffered "
+               "boundary fluxes. Backtrace:%s", e.what());
+  }
+
+  log_printf(INFO, "Double buffered boundary fluxes require %.2f MB of "
+             "memory", memory);
+}
+
+
+/**
+ * @brief Swaps the boundary flux arrays for the double buffered sweep.
+ * @details The outgoing fluxes of the previous sweep become the incoming
+ *          fluxes of this sweep. Every Track direction writes the outgoing
+ *          flux into its destination slot during the sweep, such that the
+ *          buffer which is written to need not be initialized.
+ */
+void CPUSolver::swapBoundaryFluxBuffers() {
+
+  if (_boundary_flux_precision == BOUNDARY_FLUX_FULL) {
+    std::swap(_boundary_flux, _old_boundary_flux);
+    _boundary_flux_swapped = !_boundary_flux_swapped;
+  }
+  else
+    std::swap(_packed_boundary_flux, _old_packed_boundary_flux);
+}
+
+
+/**
+ * @brief Returns the boundary flux arrays to the buffers each was allocated
+ *        as before either is deleted or reallocated.
+ * @details The _boundary_flux array may be allocated differently from the
+ *          _old_boundary_flux array by subclasses such as the
+ *          VectorizedSolver.
+ */
+void CPUSolver::restoreBoundaryFluxBuffers() {
+
+  if (_boundary_flux_swapped) {
+    std::swap(_boundary_flux, _old_boundary_flux);
+    _boundary_flux_swapped = false;
+  }
+}
+
+
+/**
+ * @brief Selects the Track segment kernel for the number of energy groups
+ *        and polar angles.
+ * @details A kernel specialized at compile time is used for 1, 2, 7 or 8
+ *          energy groups with 1, 2 or 3 polar angles, and a generic kernel
+ *          is used otherwise. A buffer is allocated for each thread for the
+ *          exponentials of a segment if they are computed on-the-fly.
+ */
+void CPUSolver::initializeSegmentKernel() {
+
+  _segment_kernel = segment_kernel<FP_PRECISION>(_num_groups, _num_polar);
+
+  if (_segment_kernel == &tally_segment<FP_PRECISION,0,0>)
+    log_printf(INFO, "Using the generic segment kernel for %d groups and %d "
+               "polar angles", _num_groups, _num_polar);
+  else
+    log_printf(INFO, "Using the segment kernel specialized for %d groups "
+               "and %d polar angles", _num_groups, _num_polar);
+
+  /* Delete the old exponentials buffer if it exists */
+  if (_thread_segment_exponentials != NULL) {
+    delete [] _thread_segment_exponentials;
+    _thread_segment_exponentials = NULL;
+  }
+
+  if (_exponentials == NULL)
+    _thread_segment_exponentials =
+         new FP_PRECISION[_num_threads*_polar_times_groups];
+}
+
+
+/**
+ * @brief Allocates the leakage tallies for the transport sweep.
+ * @details The leakage is accumulated in a partial sum for each thread as
+ *          each Track direction leaves through a vacuum boundary. Since the
+ *          partial sums depend on the assignment of Tracks to threads, the
+ *          leakage for each Track direction is stored and reduced in a
+ *          fixed order for reproducible flux updates.
+ */
+void CPUSolver::initializeLeakageTallies() {
+
+  /* Delete old leakage tallies if they exist */
+  if (_thread_leakage != NULL)
+    delete [] _thread_leakage;
+
+  if (_track_leakage != NULL) {
+    delete [] _track_leakage;
+    _track_leakage = NULL;
+  }
+
+  try{
+    _thread_leakage = new double[_num_threads*LEAKAGE_STRIDE];
+
+    if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE)
+      _track_leakage = new FP_PRECISION[2*_tot_num_tracks];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the leakage tallies. "
+               "Backtrace:%s", e.what());
+  }
+
+  if (_track_leakage != NULL) {
+    for (int i=0; i < 2*_tot_num_tracks; i++)
+      _track_leakage[i] = 0.0;
+  }
+}
+
+
+/**
+ * @brief Allocates the reduced precision boundary angular fluxes.
+ * @details The outgoing flux of each Track direction is the incoming flux
+ *          of the Track direction given by Track::getTrackOut() and
+ *          Track::isReflOut() for the forward direction, or by
+ *          Track::getTrackIn() and Track::isReflIn() for the reverse
+ *          direction, unless the boundary is a vacuum. This method inverts
+ *          these links to find the source of the incoming flux for each
+ *          Track direction.
+ */
+void CPUSolver::initializePackedBoundaryFluxes() {
+
+  /* Delete old packed boundary flux arrays if they exist */
+  if (_packed_boundary_flux != NULL) {
+    delete [] _packed_boundary_flux;
+    _packed_boundary_flux = NULL;
+  }
+
+  if (_boundary_flux_sources != NULL) {
+    delete [] _boundary_flux_sources;
+    _boundary_flux_sources = NULL;
+  }
+
+  if (_thread_boundary_flux != NULL) {
+    delete [] _thread_boundary_flux;
+    _thread_boundary_flux = NULL;
+  }
+
+  _boundary_flux_scale = 1.0;
+
+  /* Allocate a buffer for each thread for the unpacked angular flux */
+  _thread_boundary_flux = new FP_PRECISION[_num_threads*_polar_times_groups];
+
+  if (_boundary_flux_precision == BOUNDARY_FLUX_FULL)
+    return;
+
+  long size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+
+  try{
+    _packed_boundary_flux = new uint16_t[size];
+    _boundary_flux_sources = new int[2*_tot_num_tracks];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the packed boundary "
+               "fluxes. Backtrace:%s", e.what());
+  }
+
+  for (int i=0; i < 2*_tot_num_tracks; i++)
+    _boundary_flux_sources[i] = -1;
+
+  /* Link the outgoing flux of each Track direction to the next direction */
+  for (int i=0; i < _tot_num_tracks; i++) {
+
+    Track* track = _tracks[i];
+
+    if (track->getBCOut())
+      _boundary_flux_sources[2 * track->getTrackOut()->getUid() +
+                             track->isReflOut()] = 2 * i;
+
+    if (track->getBCIn())
+      _boundary_flux_sources[2 * track->getTrackIn()->getUid() +
+                             track->isReflIn()] = 2 * i + 1;
+  }
+
+  log_printf(INFO, "Packed boundary fluxes require %.2f MB of memory",
+             size * sizeof(uint16_t) / 1.E6);
+}
+
+
+/**
+ * @brief Builds the index of the segment contributions to each FSR for
+ *        reproducible flux updates.
+ * @details Each segment contributes to its FSR's scalar flux once in the
+ *          forward and once in the reverse direction. The contributions are
+ *          stored by the transport sweep and are listed for each FSR in
+ *          ascending order such that they are always reduced in the same
+ *          order regardless of the number of threads or the schedule.
+ */
+void CPUSolver::initializeContributions() {
+
+  /* Delete old contribution arrays if they exist */
+  if (_segment_fluxes != NULL) {
+    delete [] _segment_fluxes;
+    _segment_fluxes = NULL;
+  }
+
+  if (_FSR_contribution_offsets != NULL) {
+    delete [] _FSR_contribution_offsets;
+    _FSR_contribution_offsets = NULL;
+  }
+
+  if (_FSR_contributions != NULL) {
+    delete [] _FSR_contributions;
+    _FSR_contributions = NULL;
+  }
+
+  if (_thread_contributions != NULL) {
+    delete [] _thread_contributions;
+    _thread_contributions = NULL;
+  }
+
+  _max_contributions = 0;
+
+  if (_flux_update_type != FLUX_UPDATE_REPRODUCIBLE)
+    return;
+
+  int tot_num_segments = _segment_offsets[_tot_num_tracks];
+  long num_contributions = 2L * tot_num_segments;
+
+  /* The FSR contributions, and the Cmfd Mesh surface contributions which
+   * are built by initializeSurfaceContributions() */
+  double memory = (num_contributions * _num_groups * sizeof(FP_PRECISION) +
+                   (num_contributions + _num_FSRs + 1) * sizeof(long)) / 1.E6;
+
+  if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
+    memory += (num_contributions * (_num_groups * sizeof(FP_PRECISION) +
+               sizeof(long)) + (_num_mesh_cells * 8 + 1) * sizeof(long)) /
+               1.E6;
+
+  log_printf(NORMAL, "Reproducible flux updates for %d segments require "
+             "%.2f MB of memory", tot_num_segments, memory);
+
+  if (memory > _reproducible_memory_budget)
+    log_printf(ERROR, "Reproducible flux updates require %.2f MB of memory "
+               "which exceeds the memory budget of %.2f MB. Increase the "
+               "budget with CPUSolver::setReproducibleMemoryBudget() or use "
+               "another flux update type.", memory,
+               _reproducible_memory_budget);
+
+  try{
+    _segment_fluxes = new FP_PRECISION[num_contributions * _num_groups];
+    _FSR_contribution_offsets = new long[_num_FSRs+1];
+    _FSR_contributions = new long[num_contributions];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the segment "
+               "contributions to the FSR scalar fluxes. Backtrace:%s",
+               e.what());
+  }
+
+  /* Count the contributions to each FSR */
+  memset(_FSR_contribution_offsets, 0, (_num_FSRs+1) * sizeof(long));
+
+  for (int s=0; s < tot_num_segments; s++)
+    _FSR_contribution_offsets[_segment_fsr_ids[s]+1] += 2;
+
+  for (int r=0; r < _num_FSRs; r++) {
+    _max_contributions = std::max(_max_contributions,
+                                  (int)_FSR_contribution_offsets[r+1]);
+    _FSR_contribution_offsets[r+1] += _FSR_contribution_offsets[r];
+  }
+
+  /* List the contributions to each FSR in ascending order */
+  std::vector<long> next(_FSR_contribution_offsets,
+                         _FSR_contribution_offsets + _num_FSRs);
+
+  for (long c=0; c < num_contributions; c++)
+    _FSR_contributions[next[_segment_fsr_ids[c/2]]++] = c;
+
+  _thread_contributions =
+       new FP_PRECISION[(long)_num_threads * _max_contributions];
+}
+
+
+/**
+ * @brief Builds the index of the segment contributions to each Cmfd Mesh
+ *        surface for reproducible flux updates.
+ */
+void CPUSolver::initializeSurfaceContributions() {
+
+  /* Delete old contribution arrays if they exist */
+  if (_segment_currents != NULL) {
+    delete [] _segment_currents;
+    _segment_currents = NULL;
+  }
+
+  if (_surface_contribution_offsets != NULL) {
+    delete [] _surface_contribution_offsets;
+    _surface_contribution_offsets = NULL;
+  }
+
+  if (_surface_contributions != NULL) {
+    delete [] _surface_contributions;
+    _surface_contributions = NULL;
+  }
+
+  if (_flux_update_type != FLUX_UPDATE_REPRODUCIBLE)
+    return;
+
+  int tot_num_segments = _segment_offsets[_tot_num_tracks];
+  long num_contributions = 2L * tot_num_segments;
+  int num_surfaces = _num_mesh_cells * 8;
+  int surface_id;
+
+  try{
+    _segment_currents = new FP_PRECISION[num_contributions * _num_groups];
+    _surface_contribution_offsets = new long[num_surfaces+1];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the segment "
+               "contributions to the Cmfd Mesh surface currents. "
+               "Backtrace:%s", e.what());
+  }
+
+  /* Count the contributions to each surface */
+  memset(_surface_contribution_offsets, 0, (num_surfaces+1) * sizeof(long));
+
+  for (int s=0; s < tot_num_segments; s++) {
+    if (_segment_cmfd_surfaces_fwd[s] != -1)
+      _surface_contribution_offsets[_segment_cmfd_surfaces_fwd[s]+1]++;
+    if (_segment_cmfd_surfaces_bwd[s] != -1)
+      _surface_contribution_offsets[_segment_cmfd_surfaces_bwd[s]+1]++;
+  }
+
+  int max_contributions = _max_contributions;
+
+  for (int i=0; i < num_surfaces; i++) {
+    _max_contributions = std::max(_max_contributions,
+                                  (int)_surface_contribution_offsets[i+1]);
+    _surface_contribution_offsets[i+1] += _surface_contribution_offsets[i];
+  }
+
+  /* List the contributions to each surface in ascending order */
+  _surface_contributions =
+       new long[_surface_contribution_offsets[num_surfaces]];
+  std::vector<long> next(_surface_contribution_offsets,
+                         _surface_contribution_offsets + num_surfaces);
+
+  for (long c=0; c < num_contributions; c++) {
+
+    if (c % 2 == 0)
+      surface_id = _segment_cmfd_surfaces_fwd[c/2];
+    else
+      surface_id = _segment_cmfd_surfaces_bwd[c/2];
+
+    if (surface_id != -1)
+      _surface_contributions[next[surface_id]++] = c;
+  }
+
+  /* Enlarge the thread scratch buffers if a surface has more contributions
+   * than any FSR */
+  if (_max_contributions > max_contributions) {
+    delete [] _thread_contributions;
+    _thread_contributions =
+         new FP_PRECISION[(long)_num_threads * _max_contributions];
+  }
+}
+
+
+/**
+ * @brief Groups the FSRs into batches which share a Material for the FSR
+ *        source computation.
+ * @details The FSRs are sorted by Material and each Material's FSRs are
+ *          split into batches of at most SOURCE_BATCH_SIZE FSRs such that
+ *          each Material's scattering matrix is reused from cache by all
+ *          of the FSRs in a batch. The band of origin groups with non-zero
+ *          scattering cross-sections into each destination group is found
+ *          for each Material so that the zeros outside of the upscatter
+ *          and downscatter bands are skipped.
+ */
+void CPUSolver::initializeSourceBatches() {
+
+  /* Delete old source batch arrays if they exist */
+  if (_source_materials != NULL)
+    delete [] _source_materials;
+
+  if (_scatter_band_start != NULL)
+    delete [] _scatter_band_start;
+
+  if (_scatter_band_end != NULL)
+    delete [] _scatter_band_end;
+
+  if (_scatter_totals != NULL)
+    delete [] _scatter_totals;
+
+  if (_source_batch_offsets != NULL)
+    delete [] _source_batch_offsets;
+
+  if (_source_batch_materials != NULL)
+    delete [] _source_batch_materials;
+
+  if (_source_batch_FSRs != NULL)
+    delete [] _source_batch_FSRs;
+
+  /* Assign an index to each unique Material in the order it is found */
+  std::map<Material*, int> material_indices;
+  std::vector<int> FSR_material_indices(_num_FSRs);
+  std::vector<int> num_material_FSRs;
+
+  for (int r=0; r < _num_FSRs; r++) {
+    Material* material = _FSR_materials[r];
+
+    if (material_indices.find(material) == material_indices.end()) {
+      material_indices[material] = num_material_FSRs.size();
+      num_material_FSRs.push_back(0);
+    }
+
+    FSR_material_indices[r] = material_indices[material];
+    num_material_FSRs[FSR_material_indices[r]]++;
+  }
+
+  _num_source_materials = num_material_FSRs.size();
+  _source_materials = new Material*[_num_source_materials];
+
+  std::map<Material*, int>::iterator iter;
+  for (iter = material_indices.begin(); iter != material_indices.end(); ++iter)
+    _source_materials[iter->second] = iter->first;
+
+  /* Find the band of non-zero scattering cross-sections and the total
+   * scattering cross-section out of each group for each Material */
+  _scatter_band_start = new int[_num_source_materials * _num_groups];
+  _scatter_band_end = new int[_num_source_materials * _num_groups];
+  _scatter_totals = new FP_PRECISION[_num_source_materials * _num_groups];
+  int num_nonzeros = 0;
+
+  for (int m=0; m < _num_source_materials; m++) {
+    FP_PRECISION* sigma_s = _source_materials[m]->getSigmaS();
+
+    for (int g=0; g < _num_groups; g++) {
+      _scatter_totals(m,g) = 0.;
+
+      for (int G=0; G < _num_groups; G++)
+        _scatter_totals(m,g) += sigma_s[G*_num_groups+g];
+    }
+
+    for (int G=0; G < _num_groups; G++) {
+      int start = 0;
+      int end = 0;
+
+      for (int g=0; g < _num_groups; g++) {
+        if (sigma_s[G*_num_groups+g] != 0.) {
+          if (end == 0)
+            start = g;
+          end = g + 1;
+        }
+      }
+
+      _scatter_band_start(m,G) = start;
+      _scatter_band_end(m,G) = end;
+      num_nonzeros += end - start;
+    }
+  }
+
+  /* Split each Material's FSRs into batches */
+  std::vector<int> material_offsets(_num_source_materials+1, 0);
+  _num_source_batches = 0;
+
+  for (int m=0; m < _num_source_materials; m++) {
+    material_offsets[m+1] = material_offsets[m] + num_material_FSRs[m];
+    _num_source_batches += (num_material_FSRs[m] + SOURCE_BATCH_SIZE - 1)
+                           / SOURCE_BATCH_SIZE;
+  }
+
+  _source_batch_offsets = new int[_num_source_batches+1];
+  _source_batch_materials = new int[_num_source_batches];
+  _source_batch_FSRs = new int[_num_FSRs];
+
+  int batch = 0;
+  for (int m=0; m < _num_source_materials; m++) {
+    for (int i=material_offsets[m]; i < material_offsets[m+1];
+         i += SOURCE_BATCH_SIZE) {
+      _source_batch_offsets[batch] = i;
+      _source_batch_materials[batch] = m;
+      batch++;
+    }
+  }
+
+  _source_batch_offsets[_num_source_batches] = _num_FSRs;
+
+  /* Sort the FSR IDs by Material, preserving their order within each */
+  std::vector<int> next_FSR(material_offsets.begin(), material_offsets.end());
+
+  for (int r=0; r < _num_FSRs; r++)
+    _source_batch_FSRs[next_FSR[FSR_material_indices[r]]++] = r;
+
+  log_printf(INFO, "Grouped %d FSRs into %d batches for %d Materials with "
+             "%.1f%% non-zero scattering matrix bands", _num_FSRs,
+             _num_source_batches, _num_source_materials,
+             100. * num_nonzeros / (_num_source_materials * _num_groups
+                                    * _num_groups));
+}
+
+
+/**
+ * @brief Precomputes the exponentials for each segment, polar angle and
+ *        energy group if requested by the user.
+ * @details The memory required for the exponentials is reported before
+ *          they are allocated. If the memory exceeds the budget the
+ *          exponentials are computed on-the-fly in each transport sweep.
+ *          This is called before CPUSolver::initializeTauIndices() which
+ *          only stores the tau indices if the exponentials are not stored.
+ */
+void CPUSolver::initializeExponentials() {
+
+  /* Delete old stored exponentials if they exist */
+  if (_exponentials != NULL) {
+    delete [] _exponentials;
+    _exponentials = NULL;
+  }
+
+  /* Delete old tau indices which may not match the table */
+  if (_tau_indices != NULL) {
+    delete [] _tau_indices;
+    _tau_indices = NULL;
+  }
+
+  if (!_store_exponentials)
+    return;
+
+  int tot_num_segments = _segment_offsets[_tot_num_tracks];
+  long size = (long)tot_num_segments * _polar_times_groups;
+  double memory = size * sizeof(FP_PRECISION) / 1.E6;
+
+  log_printf(NORMAL, "Stored exponentials for %d segments require %.2f MB "
+             "of memory", tot_num_segments, memory);
+
+  if (memory > _exponentials_memory_budget) {
+    log_printf(WARNING, "Stored exponentials exceed the memory budget of "
+               "%.2f MB and will be computed on-the-fly",
+               _exponentials_memory_budget);
+    return;
+  }
+
+  try{
+    _exponentials = new FP_PRECISION[size];
+  }
+  catch(std::exception &e) {
+    log_printf(WARNING, "Could not allocate memory for the stored "
+               "exponentials which will be computed on-the-fly");
+    _exponentials = NULL;
+    return;
+  }
+
+  /* Evaluate the exponentials for each segment */
+  #pragma omp parallel for schedule(guided)
+  for (int s=0; s < tot_num_segments; s++)
+    computeExponentials(s, &_exponentials[(long)s * _polar_times_groups]);
+
+  return;
+}
+
+
+/**
+ * @brief Precomputes the exponential table index for each segment and
+ *        energy group.
+ * @details The indices are stored in 16 bits when requested through
+ *          CPUSolver::setStoreTauIndices() for the linear interpolation
+ *          table, unless the exponentials themselves were stored by
+ *          CPUSolver::initializeExponentials().
+ */
+void CPUSolver::initializeTauIndices() {
+
+  /* Delete old stored tau indices if they exist */
+  if (_tau_indices != NULL) {
+    delete [] _tau_indices;
+    _tau_indices = NULL;
+  }
+
+  if (!_store_tau_indices || !_interpolate_exponential ||
+      _exponentials != NULL)
+    return;
+
+  if (_exp_table_size / _two_times_num_polar > 65536) {
+    log_printf(WARNING, "The exponential table has too many values for 16 "
+               "bit tau indices which will be computed on-the-fly");
+    return;
+  }
+
+  int tot_num_segments = _segment_offsets[_tot_num_tracks];
+  long size = (long)tot_num_segments * _num_groups;
+
+  log_printf(NORMAL, "Stored tau indices for %d segments require %.2f MB "
+             "of memory", tot_num_segments, size * sizeof(uint16_t) / 1.E6);
+
+  try{
+    _tau_indices = new uint16_t[size];
+  }
+  catch(std::exception &e) {
+    log_printf(WARNING, "Could not allocate memory for the stored tau "
+               "indices which will be computed on-the-fly");
+    _tau_indices = NULL;
+    return;
+  }
+
+  /* Round the optical length of each segment to its table index */
   #pragma omp parallel for schedule(guided)
-  for (int r=0; r < _num_FSRs; r++)
-    omp_init_lock(&_FSR_locks[r]);
+  for (int s=0; s < tot_num_segments; s++) {
+
+    FP_PRECISION length = _segment_lengths[s];
+    FP_PRECISION* sigma_t = _segment_sigma_t[_segment_material_indices[s]];
+
+    for (int e=0; e < _num_groups; e++)
+      _tau_indices[(long)s*_num_groups + e] =
+           round_to_int(sigma_t[e] * length * _inverse_exp_table_spacing);
+  }
 
   return;
 }
@@ -435,6 +1683,11 @@ void CPUSolver::initializeFSRs() {
  */
 void CPUSolver::initializeCmfd() {
 
+  /* Cmfd updates the boundary fluxes in FP_PRECISION */
+  if (_boundary_flux_precision != BOUNDARY_FLUX_FULL)
+    log_printf(ERROR, "Unable to use Cmfd acceleration with reduced "
+               "precision boundary fluxes");
+
   /* Call parent class method */
   Solver::initializeCmfd();
 
@@ -458,6 +1711,8 @@ void CPUSolver::initializeCmfd() {
 
   _cmfd->setSurfaceCurrents(_surface_currents);
 
+  initializeSurfaceContributions();
+
   /* Initialize an array of OpenMP locks for each Cmfd Mesh surface */
   _cmfd_surface_locks = new omp_lock_t[_num_mesh_cells * 8];
 
@@ -470,12 +1725,97 @@ void CPUSolver::initializeCmfd() {
 }
 
 
+/**
+ * @brief Rescales the packed boundary fluxes before a transport sweep.
+ * @details The angular flux along each Track is a weighted average of the
+ *          incoming flux and the reduced sources of the FSRs it crosses,
+ *          such that the maximum of the stored boundary fluxes and the
+ *          reduced sources bounds every flux in the sweep. The scale is
+ *          changed by a power of two such that this bound is between
+ *          \f$ 2^{10} \f$ and \f$ 2^{13} \f$ when packed, which leaves FP16
+ *          a margin of eight below its largest value of 65504. The stored
+ *          fluxes are repacked exactly for the new scale. The magnitude of
+ *          both 16-bit formats increases with their bits, such that the
+ *          maximum is found with an integer max reduction which also finds
+ *          non-finite values.
+ */
+void CPUSolver::rescalePackedBoundaryFluxes() {
+
+  long size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+  bool fp16 = (_boundary_flux_precision == BOUNDARY_FLUX_FP16);
+  int max_bits = 0;
+  FP_PRECISION max_source = 0.0;
+
+  #pragma omp parallel for schedule(static) reduction(max:max_bits)
+  for (long i=0; i < size; i++)
+    max_bits = std::max(max_bits, _packed_boundary_flux[i] & 0x7FFF);
+
+  if (max_bits >= (fp16 ? 0x7C00 : 0x7F80))
+    log_printf(ERROR, "Unable to rescale the packed boundary fluxes since "
+               "they contain an infinite or NaN value");
+
+  #pragma omp parallel for schedule(static) reduction(max:max_source)
+  for (int i=0; i < _num_FSRs*_num_groups; i++)
+    max_source = std::max(max_source, (FP_PRECISION)fabs(_reduced_sources[i]));
+
+  float max_packed = fp16 ? fp16_to_float(max_bits) : bf16_to_float(max_bits);
+  double bound = std::max(max_packed * _boundary_flux_scale, max_source);
+
+  if (bound == 0.0 || !std::isfinite(bound))
+    return;
+
+  /* The power of two to multiply the packed fluxes by */
+  int exponent;
+  frexp(bound / _boundary_flux_scale, &exponent);
+  int shift = PACKED_FLUX_MAX_EXPONENT - exponent;
+
+  /* Only rescale once the bound has fallen by a factor of eight to avoid
+   * repacking the fluxes as the bound fluctuates */
+  if (shift >= 0 && shift < 3)
+    return;
+
+  float factor = ldexp(1.0f, shift);
+  _boundary_flux_scale = ldexp(_boundary_flux_scale, -shift);
+
+  log_printf(DEBUG, "Rescaled the packed boundary fluxes by 2^%d", shift);
+
+  if (max_bits == 0)
+    return;
+
+  if (fp16) {
+    #pragma omp parallel for schedule(static)
+    for (long i=0; i < size; i++)
+      _packed_boundary_flux[i] =
+           float_to_fp16(fp16_to_float(_packed_boundary_flux[i]) * factor);
+  }
+  else {
+    #pragma omp parallel for schedule(static)
+    for (long i=0; i < size; i++)
+      _packed_boundary_flux[i] =
+           float_to_bf16(bf16_to_float(_packed_boundary_flux[i]) * factor);
+  }
+}
+
+
 /**
  * @brief Zero each Track's boundary fluxes for each energy group and polar
  *        angle in the "forward" and "reverse" directions.
  */
 void CPUSolver::zeroTrackFluxes() {
 
+  if (_boundary_flux_precision != BOUNDARY_FLUX_FULL) {
+
+    long size = 2 * (long)_tot_num_tracks * _polar_times_groups;
+    _boundary_flux_scale = 1.0;
+
+    /* Zero has all bits unset in both reduced precision formats */
+    #pragma omp parallel for schedule(static)
+    for (long i=0; i < size; i++)
+      _packed_boundary_flux[i] = 0;
+
+    return;
+  }
+
   #pragma omp parallel for schedule(guided)
   for (int t=0; t < _tot_num_tracks; t++) {
     for (int d=0; d < 2; d++) {
@@ -578,6 +1918,12 @@ void CPUSolver::normalizeFluxes() {
       _scalar_flux(r,e) *= norm_factor;
   }
 
+  /* Packed boundary fluxes are normalized through their scale */
+  if (_boundary_flux_precision != BOUNDARY_FLUX_FULL) {
+    _boundary_flux_scale *= norm_factor;
+    return;
+  }
+
   /* Normalize angular boundary fluxes for each Track */
   #pragma omp parallel for schedule(guided)
   for (int i=0; i < _tot_num_tracks; i++) {
@@ -604,11 +1950,17 @@ void CPUSolver::normalizeFluxes() {
  *          \f$ res = \sqrt{\frac{\displaystyle\sum \displaystyle\sum
  *                    \left(\frac{Q^i - Q^{i-1}}{Q^i}\right)^2}{\# FSRs}} \f$
  *
+ *          The FSRs are looped over in batches which share a Material such
+ *          that the Material's scattering matrix remains in cache, and only
+ *          the band of non-zero scattering cross-sections into each group
+ *          is multiplied with the scalar flux.
+ *
  * @return the residual between this source and the previous source
  */
 FP_PRECISION CPUSolver::computeFSRSources() {
 
-  int tid;
+  int r;
+  int material_index;
   Material* material;
   FP_PRECISION scatter_source;
   FP_PRECISION fission_source;
@@ -617,67 +1969,76 @@ FP_PRECISION CPUSolver::computeFSRSources() {
   FP_PRECISION* sigma_s;
   FP_PRECISION* sigma_t;
   FP_PRECISION* chi;
+  FP_PRECISION* scalar_flux;
+  FP_PRECISION* row;
 
   FP_PRECISION source_residual = 0.0;
 
   FP_PRECISION inverse_k_eff = 1.0 / _k_eff;
 
-  /* For all FSRs, find the source */
-  #pragma omp parallel for private(tid, material, nu_sigma_f, chi, \
-    sigma_s, sigma_t, fission_source, scatter_source, fsr_fission_source) \
-    schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
+  /* For all batches of FSRs sharing a Material, find the source */
+  #pragma omp parallel for private(r, material_index, material, nu_sigma_f, \
+    chi, sigma_s, sigma_t, scalar_flux, row, fission_source, scatter_source, \
+    fsr_fission_source) schedule(guided)
+  for (int b=0; b < _num_source_batches; b++) {
 
-    tid = omp_get_thread_num();
-    material = _FSR_materials[r];
+    material_index = _source_batch_materials[b];
+    material = _source_materials[material_index];
     nu_sigma_f = material->getNuSigmaF();
     chi = material->getChi();
     sigma_s = material->getSigmaS();
     sigma_t = material->getSigmaT();
 
-    /* Initialize the source residual to zero */
-    _source_residuals[r] = 0.;
-    fsr_fission_source = 0.0;
+    /* Loop over the FSRs in this batch */
+    for (int i=_source_batch_offsets[b]; i < _source_batch_offsets[b+1]; i++) {
 
-    /* Compute fission source for each group */
-    if (material->isFissionable()) {
-      for (int e=0; e < _num_groups; e++)
-        _fission_sources(r,e) = _scalar_flux(r,e) * nu_sigma_f[e];
+      r = _source_batch_FSRs[i];
+      scalar_flux = &_scalar_flux(r,0);
 
-      fission_source = pairwise_sum<FP_PRECISION>(&_fission_sources(r,0),
-                                                  _num_groups);
-      fission_source *= inverse_k_eff;
-    }
+      /* Initialize the source residual to zero */
+      _source_residuals[r] = 0.;
+      fsr_fission_source = 0.0;
 
-    else
-      fission_source = 0.0;
+      /* Compute fission source for each group */
+      if (material->isFissionable()) {
+        for (int e=0; e < _num_groups; e++)
+          _fission_sources(r,e) = scalar_flux[e] * nu_sigma_f[e];
 
-    /* Compute total scattering source for group G */
-    for (int G=0; G < _num_groups; G++) {
-      scatter_source = 0;
+        fission_source = pairwise_sum<FP_PRECISION>(&_fission_sources(r,0),
+                                                    _num_groups);
+        fission_source *= inverse_k_eff;
+      }
 
-      for (int g=0; g < _num_groups; g++)
-        _scatter_sources(tid,g) = material->getSigmaSByGroupInline(g,G)
-                      * _scalar_flux(r,g);
+      else
+        fission_source = 0.0;
 
-      scatter_source=pairwise_sum<FP_PRECISION>(&_scatter_sources(tid,0),
-                                                _num_groups);
+      /* Compute total scattering source for group G from the origin
+       * groups within the band of non-zero scattering cross-sections */
+      for (int G=0; G < _num_groups; G++) {
+        scatter_source = 0;
+        row = &sigma_s[G*_num_groups];
 
-      /* Set the fission source for FSR r in group G */
-      fsr_fission_source += fission_source * chi[G];
+        for (int g=_scatter_band_start(material_index,G);
+             g < _scatter_band_end(material_index,G); g++)
+          scatter_source += row[g] * scalar_flux[g];
 
-      /* Set the reduced source for FSR r in group G */
-      _reduced_sources(r,G) = (fission_source * chi[G] + scatter_source) *
-                      ONE_OVER_FOUR_PI / sigma_t[G];
-    }
+        /* Set the fission source for FSR r in group G */
+        fsr_fission_source += fission_source * chi[G];
 
-    /* Compute the norm of residual of the source in the FSR */
-    if (fsr_fission_source > 0.0)
-      _source_residuals[r] = pow((fsr_fission_source - _old_fission_sources[r])
-                                 / fsr_fission_source, 2);
+        /* Set the reduced source for FSR r in group G */
+        _reduced_sources(r,G) = (fission_source * chi[G] + scatter_source) *
+                        ONE_OVER_FOUR_PI / sigma_t[G];
+      }
+
+      /* Compute the norm of residual of the source in the FSR */
+      if (fsr_fission_source > 0.0)
+        _source_residuals[r] = pow((fsr_fission_source -
+                                    _old_fission_sources[r])
+                                   / fsr_fission_source, 2);
 
-    /* Update the old source */
-    _old_fission_sources[r] = fsr_fission_source;
+      /* Update the old source */
+      _old_fission_sources[r] = fsr_fission_source;
+    }
   }
 
   /* Sum up the residuals from each FSR */
@@ -703,94 +2064,70 @@ FP_PRECISION CPUSolver::computeFSRSources() {
 void CPUSolver::computeKeff() {
 
   int tid;
+  int r;
+  int material_index;
   Material* material;
-  FP_PRECISION* sigma;
+  FP_PRECISION* sigma_t;
+  FP_PRECISION* nu_sigma_f;
+  FP_PRECISION* scatter_totals;
+  FP_PRECISION* scalar_flux;
+  FP_PRECISION* group_rates;
   FP_PRECISION volume;
 
-  FP_PRECISION total = 0.0;
-  FP_PRECISION fission = 0.0;
-  FP_PRECISION scatter = 0.0;
-
-  FP_PRECISION* FSR_rates = new FP_PRECISION[_num_FSRs];
-  FP_PRECISION* group_rates = new FP_PRECISION[_num_threads * _num_groups];
-
-  /* Loop over all FSRs and compute the volume-weighted total rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, sigma) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    sigma = material->getSigmaT();
-
-    for (int e=0; e < _num_groups; e++)
-      group_rates[tid+e] = sigma[e] * _scalar_flux(r,e);
-
-    FSR_rates[r]=pairwise_sum<FP_PRECISION>(&group_rates[tid], _num_groups);
-    FSR_rates[r] *= volume;
-  }
-
-  /* Reduce total rates across FSRs */
-  total = pairwise_sum<FP_PRECISION>(FSR_rates, _num_FSRs);
-
-  /* Loop over all FSRs and compute the volume-weighted fission rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, sigma) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    sigma = material->getNuSigmaF();
-
-    for (int e=0; e < _num_groups; e++)
-      group_rates[tid+e] = sigma[e] * _scalar_flux(r,e);
-
-    FSR_rates[r]=pairwise_sum<FP_PRECISION>(&group_rates[tid], _num_groups);
-    FSR_rates[r] *= volume;
-  }
+  FP_PRECISION* total_rates = _FSR_rates;
+  FP_PRECISION* fission_rates = &_FSR_rates[_num_FSRs];
+  FP_PRECISION* scatter_rates = &_FSR_rates[2*_num_FSRs];
 
-  /* Reduce fission rates across FSRs */
-  fission = pairwise_sum<FP_PRECISION>(FSR_rates, _num_FSRs);
+  /* Loop over all batches of FSRs sharing a Material and compute the
+   * volume-weighted total, fission and scattering rates in one pass */
+  #pragma omp parallel for private(tid, r, material_index, material, \
+    sigma_t, nu_sigma_f, scatter_totals, scalar_flux, group_rates, volume) \
+    schedule(guided)
+  for (int b=0; b < _num_source_batches; b++) {
 
-  /* Loop over all FSRs and compute the volume-weighted scattering rates */
-  #pragma omp parallel for private(tid, volume, \
-    material) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
+    tid = omp_get_thread_num();
+    group_rates = &_group_rates[3*tid*_num_groups];
+    material_index = _source_batch_materials[b];
+    material = _source_materials[material_index];
+    sigma_t = material->getSigmaT();
+    nu_sigma_f = material->getNuSigmaF();
+    scatter_totals = &_scatter_totals(material_index,0);
 
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
+    for (int i=_source_batch_offsets[b]; i < _source_batch_offsets[b+1]; i++) {
 
-    FSR_rates[r] = 0.;
+      r = _source_batch_FSRs[i];
+      volume = _FSR_volumes[r];
+      scalar_flux = &_scalar_flux(r,0);
 
-    for (int G=0; G < _num_groups; G++) {
-      for (int g=0; g < _num_groups; g++)
-        group_rates[tid+g] = material->getSigmaSByGroupInline(g,G)
-                             * _scalar_flux(r,g);
+      for (int e=0; e < _num_groups; e++) {
+        group_rates[e] = sigma_t[e] * scalar_flux[e];
+        group_rates[_num_groups+e] = nu_sigma_f[e] * scalar_flux[e];
+        group_rates[2*_num_groups+e] = scatter_totals[e] * scalar_flux[e];
+      }
 
-      FSR_rates[r]+=pairwise_sum<FP_PRECISION>(&group_rates[tid], _num_groups);
+      total_rates[r] = pairwise_sum<FP_PRECISION>(&group_rates[0],
+                                                  _num_groups) * volume;
+      fission_rates[r] = pairwise_sum<FP_PRECISION>(&group_rates[_num_groups],
+                                                    _num_groups) * volume;
+      scatter_rates[r] = pairwise_sum<FP_PRECISION>
+                         (&group_rates[2*_num_groups], _num_groups) * volume;
     }
-
-    FSR_rates[r] *= volume;
   }
 
-  /* Reduce scattering rates across FSRs */
-  scatter = pairwise_sum<FP_PRECISION>(FSR_rates, _num_FSRs);
+  /* Reduce the rates across FSRs in a fixed order independent of the
+   * number of threads */
+  FP_PRECISION total = pairwise_sum<FP_PRECISION>(total_rates, _num_FSRs);
+  FP_PRECISION fission = pairwise_sum<FP_PRECISION>(fission_rates, _num_FSRs);
+  FP_PRECISION scatter = pairwise_sum<FP_PRECISION>(scatter_rates, _num_FSRs);
 
-  /* Reduce leakage array across Tracks, energy groups, polar angles */
-  int size = 2 * _tot_num_tracks * _polar_times_groups;
-  _leakage = pairwise_sum<FP_PRECISION>(_boundary_leakage, size) * 0.5;
+  /* Reduce the leakage tallied through vacuum boundaries */
+  _leakage = computeLeakage();
 
   _k_eff = fission / (total - scatter + _leakage);
 
   log_printf(DEBUG, "tot = %f, fiss = %f, scatt = %f, leakage = %f,"
              "k_eff = %f", total, fission, scatter, _leakage, _k_eff);
 
-  delete [] FSR_rates;
-  delete [] group_rates;
-
   return;
 }
 
@@ -800,18 +2137,22 @@ void CPUSolver::computeKeff() {
  *        Tracks, Track segments, polar angles and energy groups.
  * @details The method integrates the flux along each Track and updates the
  *          boundary fluxes for the corresponding output Track, while updating
- *          the scalar flux in each flat source region.
+ *          the scalar flux in each flat source region. The Track chunks are
+ *          swept one azimuthal halfspace at a time, or all at once from the
+ *          incoming boundary fluxes of the previous sweep for the double
+ *          buffered sweep type.
  */
 void CPUSolver::transportSweep() {
 
   int tid;
-  int min_track, max_track;
   Track* curr_track;
   int azim_index;
-  int num_segments;
-  segment* curr_segment;
-  segment* segments;
+  int start_segment, end_segment;
   FP_PRECISION* track_flux;
+  FP_PRECISION* thread_fsr_flux;
+  FP_PRECISION* thread_flux;
+  double start_time;
+  long num_segments;
 
   log_printf(DEBUG, "Transport sweep with %d OpenMP threads", _num_threads);
 
@@ -821,57 +2162,153 @@ void CPUSolver::transportSweep() {
   if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
     zeroSurfaceCurrents();
 
-  /* Loop over azimuthal angle halfspaces */
-  for (int i=0; i < 2; i++) {
+  /* Initialize the leakage partial sum for each thread to zero */
+  for (int t=0; t < _num_threads; t++)
+    _thread_leakage[t*LEAKAGE_STRIDE] = 0.0;
+
+  /* The double buffered sweep reads the incoming boundary fluxes from the
+   * other buffer such that all Tracks may be swept at once while writing
+   * the outgoing fluxes */
+  int num_sweeps = 2;
+  int num_sweep_chunks = _num_track_chunks;
+
+  /* Keep the packed boundary fluxes within the range of their format */
+  if (_boundary_flux_precision != BOUNDARY_FLUX_FULL)
+    rescalePackedBoundaryFluxes();
+
+  if (_sweep_type == SWEEP_DOUBLE_BUFFERED) {
+    num_sweeps = 1;
+    num_sweep_chunks = 2 * _num_track_chunks;
+    swapBoundaryFluxBuffers();
+  }
 
-    /* Compute the minimum and maximum Track IDs corresponding to
-     * this azimuthal angular halfspace */
-    min_track = i * (_tot_num_tracks / 2);
-    max_track = (i + 1) * (_tot_num_tracks / 2);
+  /* Loop over azimuthal angle halfspaces or all Tracks at once */
+  for (int i=0; i < num_sweeps; i++) {
 
-    /* Loop over each thread within this azimuthal angle halfspace */
-    #pragma omp parallel for private(curr_track, azim_index, num_segments, \
-      curr_segment, segments, track_flux, tid) schedule(guided)
-    for (int track_id=min_track; track_id < max_track; track_id++) {
+    /* The Track chunks corresponding to this sweep */
+    int* chunk_offsets = &_track_chunk_offsets[i*_num_track_chunks];
 
+    #pragma omp parallel private(curr_track, azim_index, start_segment, \
+      end_segment, track_flux, thread_fsr_flux, thread_flux, tid, start_time, \
+      num_segments)
+    {
       tid = omp_get_thread_num();
+      start_time = Timer::getWallTime();
+      num_segments = 0;
 
-      /* Use local array accumulator to prevent false sharing*/
-      FP_PRECISION* thread_fsr_flux;
-      thread_fsr_flux = new FP_PRECISION[_num_groups];
-
-      /* Initialize local pointers to important data structures */
-      curr_track = _tracks[track_id];
-      azim_index = curr_track->getAzimAngleIndex();
-      num_segments = curr_track->getNumSegments();
-      segments = curr_track->getSegments();
-      track_flux = &_boundary_flux(track_id,0,0,0);
-
-      /* Loop over each Track segment in forward direction */
-      for (int s=0; s < num_segments; s++) {
-        curr_segment = &segments[s];
-        scalarFluxTally(curr_segment, azim_index, track_flux,
-                        thread_fsr_flux, true);
-      }
+      /* Use the thread's scratch buffer as a local FSR flux accumulator */
+      thread_fsr_flux = &_thread_fsr_flux[tid*_num_groups];
+      thread_flux = &_thread_boundary_flux[tid*_polar_times_groups];
+
+      /* Loop over each Track chunk within this sweep */
+      #pragma omp for schedule(dynamic) nowait
+      for (int c=0; c < num_sweep_chunks; c++) {
+        for (int track_id=chunk_offsets[c]; track_id < chunk_offsets[c+1];
+             track_id++) {
+
+          /* Initialize local pointers to important data structures */
+          curr_track = _tracks[track_id];
+          azim_index = curr_track->getAzimAngleIndex();
+          start_segment = _segment_offsets[track_id];
+          end_segment = _segment_offsets[track_id+1];
+          num_segments += end_segment - start_segment;
+
+          /* Loop over each Track segment in forward direction */
+          track_flux = loadBoundaryFlux(track_id, true, thread_flux);
 
-      /* Transfer boundary angular flux to outgoing Track */
-      transferBoundaryFlux(track_id, azim_index, true, track_flux);
+          for (int s=start_segment; s < end_segment; s++)
+            scalarFluxTally(s, azim_index, track_flux, thread_fsr_flux, true);
 
-      /* Loop over each Track segment in reverse direction */
-      track_flux += _polar_times_groups;
+          /* Transfer boundary angular flux to outgoing Track */
+          storeBoundaryFlux(track_id, azim_index, true, track_flux);
 
-      for (int s=num_segments-1; s > -1; s--) {
-        curr_segment = &segments[s];
-        scalarFluxTally(curr_segment, azim_index, track_flux,
-                        thread_fsr_flux, false);
+          /* Loop over each Track segment in reverse direction */
+          track_flux = loadBoundaryFlux(track_id, false, thread_flux);
+
+          for (int s=end_segment-1; s >= start_segment; s--)
+            scalarFluxTally(s, azim_index, track_flux, thread_fsr_flux, false);
+
+          /* Transfer boundary angular flux to outgoing Track */
+          storeBoundaryFlux(track_id, azim_index, false, track_flux);
+        }
       }
-      delete thread_fsr_flux;
 
-      /* Transfer boundary angular flux to outgoing Track */
-      transferBoundaryFlux(track_id, azim_index, false, track_flux);
+      /* Record the time this thread spent sweeping Tracks */
+      _thread_sweep_times[tid] += Timer::getWallTime() - start_time;
+      _thread_sweep_segments[tid] += num_segments;
+    }
+  }
+
+  /* Reduce the stored segment contributions in a fixed order */
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE)
+    reduceContributions();
+
+  return;
+}
+
+
+/**
+ * @brief Reduces the segment contributions stored by the transport sweep
+ *        into the FSR scalar fluxes and Cmfd Mesh surface currents.
+ * @details The contributions to each FSR and surface are gathered in
+ *          ascending segment order and summed with a pairwise sum such
+ *          that the result is independent of the number of threads. The
+ *          time spent in the reduction is recorded by the Timer to report
+ *          the overhead of reproducible flux updates.
+ */
+void CPUSolver::reduceContributions() {
+
+  int tid;
+  long start, end;
+  FP_PRECISION* contributions;
+
+  _timer->startTimer();
+
+  /* Reduce the contributions to each FSR's scalar flux */
+  #pragma omp parallel for private(tid, start, end, contributions) \
+    schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    tid = omp_get_thread_num();
+    contributions = &_thread_contributions[tid*_max_contributions];
+    start = _FSR_contribution_offsets[r];
+    end = _FSR_contribution_offsets[r+1];
+
+    for (int e=0; e < _num_groups; e++) {
+      for (long i=start; i < end; i++)
+        contributions[i-start] = _segment_fluxes(_FSR_contributions[i],e);
+
+      _scalar_flux(r,e) = pairwise_sum<FP_PRECISION>(contributions,
+                                                     end - start);
+    }
+  }
+
+  /* Reduce the contributions to each Cmfd Mesh surface's current */
+  if (_cmfd != NULL && _cmfd->isFluxUpdateOn()) {
+
+    #pragma omp parallel for private(tid, start, end, contributions) \
+      schedule(guided)
+    for (int s=0; s < _num_mesh_cells*8; s++) {
+
+      tid = omp_get_thread_num();
+      contributions = &_thread_contributions[tid*_max_contributions];
+      start = _surface_contribution_offsets[s];
+      end = _surface_contribution_offsets[s+1];
+
+      for (int e=0; e < _num_groups; e++) {
+        for (long i=start; i < end; i++)
+          contributions[i-start] =
+               _segment_currents(_surface_contributions[i],e);
+
+        _surface_currents(s,e) += pairwise_sum<FP_PRECISION>(contributions,
+                                                             end - start);
+      }
     }
   }
 
+  _timer->stopTimer();
+  _timer->recordSplit("Reproducible flux reductions");
+
   return;
 }
 
@@ -881,103 +2318,277 @@ void CPUSolver::transportSweep() {
  * @details This method integrates the angular flux for a Track segment across
  *          energy groups and polar angles, and tallies it into the FSR
  *          scalar flux, and updates the Track's angular flux.
- * @param curr_segment a pointer to the Track segment of interest
+ * @param segment_id the index of the segment in the flat segment arrays
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param track_flux a pointer to the Track's angular flux
  * @param fsr_flux a pointer to the temporary FSR flux buffer
  * @param fwd
  */
-void CPUSolver::scalarFluxTally(segment* curr_segment,
+void CPUSolver::scalarFluxTally(int segment_id,
                                 int azim_index,
                                 FP_PRECISION* track_flux,
                                 FP_PRECISION* fsr_flux,
                                 bool fwd){
 
   int tid = omp_get_thread_num();
-  int fsr_id = curr_segment->_region_id;
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  int fsr_id = _segment_fsr_ids[segment_id];
+  FP_PRECISION* stored_exponentials;
 
-  /* The change in angular flux along this Track segment in the FSR */
-  FP_PRECISION delta_psi;
-  FP_PRECISION exponential;
+  /* Use the stored exponentials or compute them for this segment */
+  if (_exponentials != NULL)
+    stored_exponentials = &_exponentials[(long)segment_id*_polar_times_groups];
+  else {
+    stored_exponentials = &_thread_segment_exponentials[tid *
+                                                        _polar_times_groups];
+    computeExponentials(segment_id, stored_exponentials);
+  }
 
   /* Set the FSR scalar flux buffer to zero */
   memset(fsr_flux, 0.0, _num_groups * sizeof(FP_PRECISION));
 
-  /* Loop over energy groups */
-  for (int e=0; e < _num_groups; e++) {
-
-    /* Loop over polar angles */
-    for (int p=0; p < _num_polar; p++){
-      exponential = computeExponential(sigma_t[e], length, p);
-      delta_psi = (track_flux(p,e)-_reduced_sources(fsr_id,e))*exponential;
-      fsr_flux[e] += delta_psi * _polar_weights(azim_index,p);
-      track_flux(p,e) -= delta_psi;
-    }
-  }
+  /* Attenuate the angular flux and tally the FSR scalar flux */
+  _segment_kernel(_num_groups, _num_polar, track_flux,
+                  &_reduced_sources(fsr_id,0), stored_exponentials,
+                  &_polar_weights(azim_index,0), fsr_flux);
 
   if (_cmfd != NULL && _cmfd->isFluxUpdateOn()){
-    if (curr_segment->_cmfd_surface_fwd != -1 && fwd){
 
-      int pe = 0;
+    int surface_id;
 
-      /* Atomically increment the Cmfd Mesh surface current from the
-       * temporary array using mutual exclusion locks */
-      omp_set_lock(&_cmfd_surface_locks[curr_segment->_cmfd_surface_fwd]);
+    if (fwd)
+      surface_id = _segment_cmfd_surfaces_fwd[segment_id];
+    else
+      surface_id = _segment_cmfd_surfaces_bwd[segment_id];
 
-      /* Loop over energy groups */
-      for (int e = 0; e < _num_groups; e++) {
+    if (surface_id != -1) {
 
-        /* Loop over polar angles */
-        for (int p = 0; p < _num_polar; p++){
+      /* Store the current for the reproducible reduction */
+      if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE) {
+        long contribution_id = 2L * segment_id + !fwd;
 
-          /* Increment current (polar and azimuthal weighted flux, group) */
-          _surface_currents(curr_segment->_cmfd_surface_fwd,e) +=
-              track_flux(p,e)*_polar_weights(azim_index,p)/2.0;
-          pe++;
+        for (int e=0; e < _num_groups; e++) {
+          _segment_currents(contribution_id,e) = 0.;
+          for (int p=0; p < _num_polar; p++)
+            _segment_currents(contribution_id,e) +=
+                 track_flux(p,e)*_polar_weights(azim_index,p)/2.0;
         }
       }
+      else
+        tallySurfaceCurrent(surface_id, azim_index, track_flux);
+    }
+  }
 
-      /* Release Cmfd Mesh surface mutual exclusion lock */
-      omp_unset_lock(&_cmfd_surface_locks[curr_segment->_cmfd_surface_fwd]);
+  /* Store the FSR scalar flux for the reproducible reduction */
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE)
+    memcpy(&_segment_fluxes(2L*segment_id + !fwd,0), fsr_flux,
+           _num_groups * sizeof(FP_PRECISION));
 
+  /* Atomically increment the FSR scalar flux from the temporary array */
+  else if (_flux_update_type == FLUX_UPDATE_ATOMIC) {
+    for (int e=0; e < _num_groups; e++) {
+      #pragma omp atomic
+      _scalar_flux(fsr_id,e) += fsr_flux[e];
+    }
+  }
+  else {
+    omp_set_lock(&_FSR_locks[fsr_id]);
+    {
+      for (int e=0; e < _num_groups; e++)
+        _scalar_flux(fsr_id,e) += fsr_flux[e];
     }
-    else if (curr_segment->_cmfd_surface_bwd != -1 && !fwd){
+    omp_unset_lock(&_FSR_locks[fsr_id]);
+  }
 
-      int pe = 0;
+  return;
+}
 
-      /* Atomically increment the Cmfd Mesh surface current from the
-       * temporary array using mutual exclusion locks */
-      omp_set_lock(&_cmfd_surface_locks[curr_segment->_cmfd_surface_bwd]);
 
-      /* Loop over energy groups */
-      for (int e = 0; e < _num_groups; e++) {
+/**
+ * @brief Returns the incoming angular flux for a Track direction.
+ * @details Full precision boundary fluxes are swept in place, from the
+ *          copy of the incoming fluxes for the double buffered sweep.
+ *          Packed boundary fluxes are unpacked from the outgoing flux of
+ *          the source Track direction into the thread's buffer.
+ * @param track_id the ID number for the Track of interest
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @param thread_flux a pointer to the thread's angular flux buffer
+ * @return a pointer to the Track's angular flux
+ */
+FP_PRECISION* CPUSolver::loadBoundaryFlux(int track_id, bool direction,
+                                          FP_PRECISION* thread_flux) {
 
-        /* Loop over polar angles */
-        for (int p = 0; p < _num_polar; p++){
+  long index = (2 * (long)track_id + !direction) * _polar_times_groups;
 
-          /* Increment current (polar and azimuthal weighted flux, group) */
-          _surface_currents(curr_segment->_cmfd_surface_bwd,e) +=
-              track_flux(p,e)*_polar_weights(azim_index,p)/2.0;
-          pe++;
-        }
-      }
+  if (_boundary_flux_precision == BOUNDARY_FLUX_FULL) {
+    if (_sweep_type == SWEEP_DOUBLE_BUFFERED)
+      return &_old_boundary_flux[index];
+    else
+      return &_boundary_flux[index];
+  }
 
-      /* Release Cmfd Mesh surface mutual exclusion lock */
-      omp_unset_lock(&_cmfd_surface_locks[curr_segment->_cmfd_surface_bwd]);
-    }
+  int source = _boundary_flux_sources[2 * track_id + !direction];
+
+  /* The incoming flux through a vacuum boundary is zero */
+  if (source == -1) {
+    for (int i=0; i < _polar_times_groups; i++)
+      thread_flux[i] = 0.0;
+    return thread_flux;
   }
 
-  /* Atomically increment the FSR scalar flux from the temporary array */
-  omp_set_lock(&_FSR_locks[fsr_id]);
-  {
+  uint16_t* packed_flux = (_sweep_type == SWEEP_DOUBLE_BUFFERED) ?
+       _old_packed_boundary_flux : _packed_boundary_flux;
+  packed_flux = &packed_flux[(long)source * _polar_times_groups];
+
+  if (_boundary_flux_precision == BOUNDARY_FLUX_FP16) {
+    for (int i=0; i < _polar_times_groups; i++)
+      thread_flux[i] = fp16_to_float(packed_flux[i]) * _boundary_flux_scale;
+  }
+  else {
+    for (int i=0; i < _polar_times_groups; i++)
+      thread_flux[i] = bf16_to_float(packed_flux[i]) * _boundary_flux_scale;
+  }
+
+  return thread_flux;
+}
+
+
+/**
+ * @brief Stores the outgoing angular flux for a Track direction.
+ * @details Full precision boundary fluxes are transferred to the outgoing
+ *          Track given the boundary conditions. Packed boundary fluxes are
+ *          stored for the Track direction itself, and the leakage is
+ *          tallied for vacuum boundaries.
+ * @param track_id the ID number for the Track of interest
+ * @param azim_index the azimuthal angle index for the Track
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @param track_flux a pointer to the Track's outgoing angular flux
+ */
+void CPUSolver::storeBoundaryFlux(int track_id, int azim_index,
+                                  bool direction, FP_PRECISION* track_flux) {
+
+  if (_boundary_flux_precision == BOUNDARY_FLUX_FULL) {
+    transferBoundaryFlux(track_id, azim_index, direction, track_flux);
+    return;
+  }
+
+  long index = (2 * (long)track_id + !direction) * _polar_times_groups;
+  uint16_t* packed_flux = &_packed_boundary_flux[index];
+  float inverse_scale = 1.0 / _boundary_flux_scale;
+  bool bc;
+
+  if (direction)
+    bc = _tracks[track_id]->getBCOut();
+  else
+    bc = _tracks[track_id]->getBCIn();
+
+  if (!bc)
+    tallyLeakage(track_id, azim_index, direction, track_flux);
+
+  if (_boundary_flux_precision == BOUNDARY_FLUX_FP16) {
+    for (int i=0; i < _polar_times_groups; i++)
+      packed_flux[i] = float_to_fp16(track_flux[i] * inverse_scale);
+  }
+  else {
+    for (int i=0; i < _polar_times_groups; i++)
+      packed_flux[i] = float_to_bf16(track_flux[i] * inverse_scale);
+  }
+}
+
+
+/**
+ * @brief Tallies the leakage of a Track's outgoing angular flux through a
+ *        vacuum boundary.
+ * @param track_id the ID number for the Track of interest
+ * @param azim_index the azimuthal angle index for the Track
+ * @param direction the Track direction (forward - true, reverse - false)
+ * @param track_flux a pointer to the Track's outgoing angular flux
+ */
+void CPUSolver::tallyLeakage(int track_id, int azim_index, bool direction,
+                             FP_PRECISION* track_flux) {
+
+  double leakage = 0.0;
+
+  for (int p=0; p < _num_polar; p++) {
     for (int e=0; e < _num_groups; e++)
-      _scalar_flux(fsr_id,e) += fsr_flux[e];
+      leakage += track_flux(p,e) * _polar_weights(azim_index,p);
   }
-  omp_unset_lock(&_FSR_locks[fsr_id]);
 
-  return;
+  if (_track_leakage != NULL)
+    _track_leakage[2*track_id + !direction] = leakage;
+  else
+    _thread_leakage[omp_get_thread_num()*LEAKAGE_STRIDE] += leakage;
+}
+
+
+/**
+ * @brief Reduces the leakage tallied by the transport sweep.
+ * @return the total leakage through vacuum boundaries
+ */
+FP_PRECISION CPUSolver::computeLeakage() {
+
+  if (_track_leakage != NULL)
+    return pairwise_sum<FP_PRECISION>(_track_leakage, 2*_tot_num_tracks) * 0.5;
+
+  double leakage = 0.0;
+
+  for (int t=0; t < _num_threads; t++)
+    leakage += _thread_leakage[t*LEAKAGE_STRIDE];
+
+  return leakage * 0.5;
+}
+
+
+/**
+ * @brief Tallies the current crossing a Cmfd Mesh surface from a Track's
+ *        angular flux.
+ * @details The current is updated atomically using either a mutual exclusion
+ *          lock for the surface or lock-free atomic additions depending on
+ *          the flux update type.
+ * @param surface_id the ID of the Cmfd Mesh surface crossed
+ * @param azim_index the azimuthal angle index for the Track
+ * @param track_flux a pointer to the Track's angular flux
+ */
+void CPUSolver::tallySurfaceCurrent(int surface_id, int azim_index,
+                                    FP_PRECISION* track_flux) {
+
+  FP_PRECISION current;
+
+  if (_flux_update_type == FLUX_UPDATE_ATOMIC) {
+
+    /* Loop over energy groups */
+    for (int e=0; e < _num_groups; e++) {
+
+      /* Compute the polar and azimuthal weighted current for this group */
+      current = 0.;
+      for (int p=0; p < _num_polar; p++)
+        current += track_flux(p,e)*_polar_weights(azim_index,p)/2.0;
+
+      #pragma omp atomic
+      _surface_currents(surface_id,e) += current;
+    }
+  }
+
+  else {
+
+    /* Atomically increment the Cmfd Mesh surface current from the
+     * temporary array using mutual exclusion locks */
+    omp_set_lock(&_cmfd_surface_locks[surface_id]);
+
+    /* Loop over energy groups */
+    for (int e=0; e < _num_groups; e++) {
+
+      /* Loop over polar angles */
+      for (int p=0; p < _num_polar; p++) {
+
+        /* Increment current (polar and azimuthal weighted flux, group) */
+        _surface_currents(surface_id,e) +=
+            track_flux(p,e)*_polar_weights(azim_index,p)/2.0;
+      }
+    }
+
+    /* Release Cmfd Mesh surface mutual exclusion lock */
+    omp_unset_lock(&_cmfd_surface_locks[surface_id]);
+  }
 }
 
 
@@ -987,9 +2598,10 @@ void CPUSolver::scalarFluxTally(segment* curr_segment,
  * @details This method computes \f$ 1 - exp(-l\Sigma^T_g/sin(\theta_p)) \f$
  *          for a segment with total group cross-section and for some polar
  *          angle. This method uses either a linear interpolation table
- *          (default) or the exponential intrinsic exp(...) function if
- *          requested by the user through a call to the
- *          Solver::useExponentialIntrinsic()  routine.
+ *          (default), the exponential intrinsic exp(...) function or a
+ *          rational approximation if requested by the user through a call
+ *          to the Solver::useExponentialIntrinsic() or
+ *          Solver::useExponentialRational() routines.
  * @param sigma_t the total group cross-section at this energy
  * @param length the length of the Track segment projected in the xy-plane
  * @param p the polar angle index
@@ -1003,13 +2615,18 @@ FP_PRECISION CPUSolver::computeExponential(FP_PRECISION sigma_t,
 
   /* Evaluate the exponential using the lookup table - linear interpolation */
   if (_interpolate_exponential) {
-    int index;
-    index = round_to_int(tau * _inverse_exp_table_spacing);
-    index *= _two_times_num_polar;
-    exponential = (1. - (_exp_table[index+2 * p] * tau +
-                  _exp_table[index + 2 * p +1]));
+    int index = round_to_int(tau * _inverse_exp_table_spacing);
+
+    if (_exp_table_single != NULL)
+      exponential = interpolateExponential<float>(index, tau, p);
+    else
+      exponential = interpolateExponential<double>(index, tau, p);
   }
 
+  /* Evaluate the exponential using the rational approximation */
+  else if (_rational_exponential)
+    exponential = rational_exponential(tau / _quad->getSinTheta(p));
+
   /* Evalute the exponential using the intrinsic exp(...) function */
   else {
     FP_PRECISION sintheta = _quad->getSinTheta(p);
@@ -1020,6 +2637,34 @@ FP_PRECISION CPUSolver::computeExponential(FP_PRECISION sigma_t,
 }
 
 
+/**
+ * @brief Computes the exponentials in the transport equation for each
+ *        polar angle and energy group for a Track segment.
+ * @details The linear interpolation table is evaluated by the method for
+ *          the table's precision which was selected when the table was
+ *          built.
+ * @param segment_id the index of the segment in the flat segment arrays
+ * @param stored_exponentials the array to store the exponentials
+ */
+void CPUSolver::computeExponentials(int segment_id,
+                                   FP_PRECISION* stored_exponentials) {
+
+  if (_interpolate_exponential) {
+    (this->*_interpolate_exponentials)(segment_id, stored_exponentials);
+    return;
+  }
+
+  FP_PRECISION length = _segment_lengths[segment_id];
+  FP_PRECISION* sigma_t =
+      _segment_sigma_t[_segment_material_indices[segment_id]];
+
+  for (int p=0; p < _num_polar; p++) {
+    for (int e=0; e < _num_groups; e++)
+      stored_exponentials(p,e) = computeExponential(sigma_t[e], length, p);
+  }
+}
+
+
 /**
  * @brief Updates the boundary flux for a Track given boundary conditions.
  * @details For reflective boundary conditions, the outgoing boundary flux
@@ -1036,17 +2681,15 @@ void CPUSolver::transferBoundaryFlux(int track_id,
                                      FP_PRECISION* track_flux) {
   int start;
   int bc;
-  FP_PRECISION* track_leakage;
   int track_out_id;
 
   /* Extract boundary conditions for this Track and the pointer to the
-   * outgoing reflective Track, and index into the leakage array */
+   * outgoing reflective Track */
 
   /* For the "forward" direction */
   if (direction) {
     start = _tracks[track_id]->isReflOut() * _polar_times_groups;
     bc = (int)_tracks[track_id]->getBCOut();
-    track_leakage = &_boundary_leakage(track_id,0);
     track_out_id = _tracks[track_id]->getTrackOut()->getUid();
   }
 
@@ -1054,19 +2697,19 @@ void CPUSolver::transferBoundaryFlux(int track_id,
   else {
     start = _tracks[track_id]->isReflIn() * _polar_times_groups;
     bc = (int)_tracks[track_id]->getBCIn();
-    track_leakage = &_boundary_leakage(track_id,_polar_times_groups);
     track_out_id = _tracks[track_id]->getTrackIn()->getUid();
   }
 
+  /* Tally the outgoing flux through a vacuum boundary as leakage */
+  if (!bc)
+    tallyLeakage(track_id, azim_index, direction, track_flux);
+
   FP_PRECISION* track_out_flux = &_boundary_flux(track_out_id,0,0,start);
 
   /* Loop over polar angles and energy groups */
   for (int e=0; e < _num_groups; e++) {
-    for (int p=0; p < _num_polar; p++) {
+    for (int p=0; p < _num_polar; p++)
       track_out_flux(p,e) = track_flux(p,e) * bc;
-      track_leakage(p,e) = track_flux(p,e) *
-                            _polar_weights(azim_index,p) * (!bc);
-    }
   }
 }
 
@@ -1138,3 +2781,40 @@ void CPUSolver::computeFSRFissionRates(double* fission_rates, int num_FSRs) {
 
   return;
 }
+
+
+/**
+ * @brief Prints a report of the timing statistics to the console.
+ * @details In addition to the Solver's timing statistics, this reports the
+ *          time and number of segments swept by each thread and the load
+ *          imbalance between threads in the transport sweep.
+ */
+void CPUSolver::printTimerReport() {
+
+  Solver::printTimerReport();
+
+  if (_thread_sweep_times == NULL)
+    return;
+
+  std::string msg_string;
+
+  log_printf(TITLE, "LOAD BALANCE REPORT");
+
+  msg_string = "Track chunks per halfspace";
+  msg_string.resize(53, '.');
+  log_printf(RESULT, "%s%d", msg_string.c_str(), _num_track_chunks);
+
+  for (int t=0; t < _num_threads; t++) {
+    std::stringstream msg;
+    msg << "Thread " << t << " sweep time (" << _thread_sweep_segments[t]
+        << " segments)";
+    msg_string = msg.str();
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(),
+               _thread_sweep_times[t]);
+  }
+
+  msg_string = "Maximum to mean thread sweep time";
+  msg_string.resize(53, '.');
+  log_printf(RESULT, "%s%1.4f", msg_string.c_str(), getLoadImbalance());
+}
@@ -15,6 +15,9 @@
 #include <omp.h>
 #include <stdlib.h>
 #include "Solver.h"
+#include "half_precision.h"
+#include "rational_exp.h"
+#include "segment_kernels.h"
 #endif
 
 /** Indexing macro for the angular fluxes for each polar angle and energy
@@ -25,9 +28,109 @@
  *  group for the outgoing reflective track from a given Track */
 #define track_out_flux(p,e) (track_out_flux[(p)*_num_groups + (e)])
 
-/** Indexing macro for the leakage for each polar angle and energy group
- *  for either the forward or reverse direction for a given Track */
-#define track_leakage(p,e) (track_leakage[(p)*_num_groups + (e)])
+/** Indexing macro for the stored exponentials for each polar angle and
+ *  energy group for a given Track segment */
+#define stored_exponentials(p,e) (stored_exponentials[(p)*_num_groups + (e)])
+
+/** Indexing macro for the first origin group which scatters into each
+ *  destination group for each source Material */
+#define _scatter_band_start(m,G) (_scatter_band_start[(m)*_num_groups + (G)])
+
+/** Indexing macro for one past the last origin group which scatters into
+ *  each destination group for each source Material */
+#define _scatter_band_end(m,G) (_scatter_band_end[(m)*_num_groups + (G)])
+
+/** Indexing macro for the FSR scalar flux contribution from each segment
+ *  in each direction for reproducible flux updates */
+#define _segment_fluxes(c,e) (_segment_fluxes[(long)(c)*_num_groups + (e)])
+
+/** Indexing macro for the Cmfd Mesh surface current contribution from each
+ *  segment in each direction for reproducible flux updates */
+#define _segment_currents(c,e) (_segment_currents[(long)(c)*_num_groups + (e)])
+
+/** Indexing macro for the total scattering cross-section out of each
+ *  origin group for each source Material */
+#define _scatter_totals(m,g) (_scatter_totals[(m)*_num_groups + (g)])
+
+/** The stride between the partial leakage sums for each thread, such that
+ *  each thread's sum is on a separate 64 byte cache line */
+#define LEAKAGE_STRIDE 8
+
+/** The number of Track chunks per thread in each azimuthal halfspace */
+#define TRACK_CHUNKS_PER_THREAD 8
+
+/** The cost of the boundary flux transfer for a Track relative to the
+ *  cost of a segment in the Track chunk cost model */
+#define TRACK_COST_OVERHEAD 2
+
+/** The maximum number of FSRs sharing a Material in each batch of the
+ *  FSR source computation */
+#define SOURCE_BATCH_SIZE 64
+
+/** The base two exponent of the bound on the packed boundary fluxes, such
+ *  that the largest packed flux is below 2^13 and FP16 does not overflow */
+#define PACKED_FLUX_MAX_EXPONENT 13
+
+
+/**
+ * @enum fluxUpdateType
+ * @brief The synchronization used to tally FSR scalar fluxes and Cmfd Mesh
+ *        surface currents during the transport sweep.
+ */
+enum fluxUpdateType {
+
+  /** OpenMP mutual exclusion locks for each FSR and Cmfd Mesh surface */
+  FLUX_UPDATE_LOCKS,
+
+  /** Lock-free atomic floating point additions for each energy group */
+  FLUX_UPDATE_ATOMIC,
+
+  /** Contributions stored for each segment and reduced in a fixed order
+   *  which is independent of the number of threads */
+  FLUX_UPDATE_REPRODUCIBLE
+};
+
+
+/**
+ * @enum sweepType
+ * @brief The order in which Tracks are swept and exchange boundary angular
+ *        fluxes in the transport sweep.
+ * @details Sweeping each cycle of Tracks linked by their boundary conditions
+ *          in sequence is not offered. Although each Track then receives
+ *          the outgoing flux of the previous Track within the same sweep,
+ *          the fresher boundary fluxes slow the source iteration: a
+ *          reflective pin cell needed 129 source iterations to converge to
+ *          1E-9 compared to 85 for the halfspace sweep, while the
+ *          parallelism was limited to the number of cycles.
+ */
+enum sweepType {
+
+  /** Each azimuthal halfspace is swept in turn such that the second uses
+   *  the boundary fluxes updated by the first */
+  SWEEP_HALFSPACES,
+
+  /** All Tracks are swept at once with the boundary fluxes from the
+   *  previous sweep */
+  SWEEP_DOUBLE_BUFFERED
+};
+
+
+/**
+ * @enum boundaryFluxPrecision
+ * @brief The precision in which the Track boundary angular fluxes are
+ *        stored between transport sweeps.
+ */
+enum boundaryFluxPrecision {
+
+  /** The incoming flux for each Track direction in FP_PRECISION */
+  BOUNDARY_FLUX_FULL,
+
+  /** The outgoing flux for each Track direction in IEEE half precision */
+  BOUNDARY_FLUX_FP16,
+
+  /** The outgoing flux for each Track direction in bfloat16 */
+  BOUNDARY_FLUX_BF16
+};
 
 
 /**
@@ -48,11 +151,207 @@ protected:
   /** OpenMP mutual exclusion locks for atomic surface current updates */
   omp_lock_t* _cmfd_surface_locks;
 
+  /** A scratch buffer for each thread for the FSR scalar flux contribution
+   *  from a segment in each energy group */
+  FP_PRECISION* _thread_fsr_flux;
+
+  /** An array of pointers to the total cross-sections for each Material
+   *  indexed by the segment Material indices */
+  FP_PRECISION** _segment_sigma_t;
+
+  /** The synchronization used for FSR scalar flux and surface current
+   *  updates in the transport sweep */
+  fluxUpdateType _flux_update_type;
+
+  /** Whether to precompute and store the exponentials for each segment,
+   *  polar angle and energy group (true) or not (false) */
+  bool _store_exponentials;
+
+  /** The maximum memory (MB) which may be used to store exponentials */
+  double _exponentials_memory_budget;
+
+  /** The stored exponentials for each segment, polar angle and energy
+   *  group, or NULL if the exponentials are computed on-the-fly */
+  FP_PRECISION* _exponentials;
+
+  /** A scratch buffer for each thread for the exponentials of a segment
+   *  which are computed on-the-fly */
+  FP_PRECISION* _thread_segment_exponentials;
+
+  /** The slopes and intercepts of the exponential linear interpolation
+   *  table for each optical length and polar angle in single precision,
+   *  or NULL if the table is stored in double precision */
+  float* _exp_table_single;
+
+  /** The slopes and intercepts of the exponential linear interpolation
+   *  table for each optical length and polar angle in double precision,
+   *  or NULL if the table is stored in single precision */
+  double* _exp_table_double;
+
+  /** Whether to precompute and store the exponential table index for each
+   *  segment and energy group (true) or not (false) */
+  bool _store_tau_indices;
+
+  /** The stored exponential table index for each segment and energy group,
+   *  or NULL if the indices are computed on-the-fly */
+  uint16_t* _tau_indices;
+
+  /** The method which interpolates the exponentials for a segment in the
+   *  precision of the exponential table */
+  void (CPUSolver::*_interpolate_exponentials)(int segment_id,
+                                               FP_PRECISION* exponentials);
+
+  /** The Track segment kernel for the number of energy groups and polar
+   *  angles selected from segment_kernels.h */
+  void (*_segment_kernel)(int num_groups, int num_polar,
+                          FP_PRECISION* track_flux,
+                          const FP_PRECISION* sources,
+                          const FP_PRECISION* exponentials,
+                          const FP_PRECISION* weights,
+                          FP_PRECISION* fsr_flux);
+
+  /** The number of unique Materials filling the FSRs */
+  int _num_source_materials;
+
+  /** An array of the unique Materials filling the FSRs */
+  Material** _source_materials;
+
+  /** The first origin group with a non-zero scattering cross-section into
+   *  each destination group for each source Material */
+  int* _scatter_band_start;
+
+  /** One past the last origin group with a non-zero scattering
+   *  cross-section into each destination group for each source Material */
+  int* _scatter_band_end;
+
+  /** The total scattering cross-section out of each origin group for each
+   *  source Material */
+  FP_PRECISION* _scatter_totals;
+
+  /** The number of batches of FSRs which share a Material */
+  int _num_source_batches;
+
+  /** The index into the sorted FSR array of the first FSR in each batch */
+  int* _source_batch_offsets;
+
+  /** The source Material index for each batch */
+  int* _source_batch_materials;
+
+  /** The FSR IDs sorted by Material */
+  int* _source_batch_FSRs;
+
+  /** The FSR scalar flux contribution from each segment in each direction
+   *  for reproducible flux updates */
+  FP_PRECISION* _segment_fluxes;
+
+  /** The Cmfd Mesh surface current contribution from each segment in each
+   *  direction for reproducible flux updates */
+  FP_PRECISION* _segment_currents;
+
+  /** The index of the first segment contribution to each FSR */
+  long* _FSR_contribution_offsets;
+
+  /** The segment contributions (twice the segment index plus one for the
+   *  reverse direction) to each FSR in ascending order */
+  long* _FSR_contributions;
+
+  /** The index of the first segment contribution to each Cmfd Mesh surface */
+  long* _surface_contribution_offsets;
+
+  /** The segment contributions to each Cmfd Mesh surface in ascending order */
+  long* _surface_contributions;
+
+  /** The maximum memory (MB) which may be used for reproducible flux
+   *  updates */
+  double _reproducible_memory_budget;
+
+  /** The maximum number of segment contributions to any FSR or surface */
+  int _max_contributions;
+
+  /** A scratch buffer for each thread to gather the segment contributions
+   *  to an FSR or surface for the reproducible reduction */
+  FP_PRECISION* _thread_contributions;
+
+  /** The order in which Tracks are swept */
+  sweepType _sweep_type;
+
+  /** A copy of the incoming boundary fluxes for each Track for the double
+   *  buffered sweep, or NULL for the halfspace sweep */
+  FP_PRECISION* _old_boundary_flux;
+
+  /** The precision in which the boundary angular fluxes are stored */
+  boundaryFluxPrecision _boundary_flux_precision;
+
+  /** The outgoing angular flux for each Track direction divided by the
+   *  boundary flux scale in reduced precision, or NULL if the boundary
+   *  fluxes are stored in full precision */
+  uint16_t* _packed_boundary_flux;
+
+  /** A copy of the packed outgoing fluxes for the double buffered sweep */
+  uint16_t* _old_packed_boundary_flux;
+
+  /** Whether the _boundary_flux and _old_boundary_flux arrays are swapped
+   *  with respect to the buffers each was allocated as */
+  bool _boundary_flux_swapped;
+
+  /** The Track direction whose outgoing flux is the incoming flux for each
+   *  Track direction, or -1 for a vacuum boundary */
+  int* _boundary_flux_sources;
+
+  /** The factor which multiplies the packed boundary fluxes, which is
+   *  rescaled by a power of two before each transport sweep */
+  FP_PRECISION _boundary_flux_scale;
+
+  /** A scratch buffer for each thread for the unpacked angular flux of the
+   *  Track direction being swept */
+  FP_PRECISION* _thread_boundary_flux;
+
+  /** The number of Track chunks in each azimuthal halfspace */
+  int _num_track_chunks;
+
+  /** The first Track ID of each Track chunk in both halfspaces */
+  int* _track_chunk_offsets;
+
+  /** The time each thread spent sweeping Tracks in all transport sweeps */
+  double* _thread_sweep_times;
+
+  /** The number of segments swept by each thread in all transport sweeps */
+  long* _thread_sweep_segments;
+
+  /** The partial sums of the leakage through vacuum boundaries for each
+   *  thread, separated by LEAKAGE_STRIDE */
+  double* _thread_leakage;
+
+  /** The leakage through the vacuum boundary at the end of each Track
+   *  direction for reproducible flux updates, or NULL otherwise */
+  FP_PRECISION* _track_leakage;
+
+  /** The volume-weighted total, fission and scattering rates for each FSR
+   *  stored as three consecutive arrays */
+  FP_PRECISION* _FSR_rates;
+
+  /** A scratch buffer for each thread for the total, fission and
+   *  scattering rates in each energy group */
+  FP_PRECISION* _group_rates;
+
   void initializeFluxArrays();
   void initializeSourceArrays();
   void initializePolarQuadrature();
   void buildExpInterpTable();
   void initializeFSRs();
+  void initializeExponentials();
+  void initializeTauIndices();
+  void initializeSegmentKernel();
+  void initializeSourceBatches();
+  void initializeContributions();
+  void initializeTrackChunks();
+  void initializePackedBoundaryFluxes();
+  void rescalePackedBoundaryFluxes();
+  void initializeBoundaryFluxBuffer();
+  void swapBoundaryFluxBuffers();
+  void restoreBoundaryFluxBuffers();
+  void initializeLeakageTallies();
+  void initializeSurfaceContributions();
   void initializeCmfd();
 
   void zeroTrackFluxes();
@@ -64,13 +363,13 @@ protected:
 
   /**
    * @brief Computes the contribution to the FSR flux from a Track segment.
-   * @param curr_segment a pointer to the Track segment of interest
+   * @param segment_id the index of the segment in the flat segment arrays
    * @param azim_index a pointer to the azimuthal angle index for this segment
    * @param track_flux a pointer to the Track's angular flux
    * @param fsr_flux a pointer to the temporary FSR scalar flux buffer
    * @param fwd
    */
-  virtual void scalarFluxTally(segment* curr_segment, int azim_index,
+  virtual void scalarFluxTally(int segment_id, int azim_index,
                                FP_PRECISION* track_flux, FP_PRECISION* fsr_flux,
                                bool fwd);
 
@@ -84,9 +383,26 @@ protected:
   virtual void transferBoundaryFlux(int track_id, int azim_index,
                                     bool direction,
                                     FP_PRECISION* track_flux);
+
+  /**
+   * @brief Tallies the current crossing a Cmfd Mesh surface from a Track.
+   * @param surface_id the ID of the Cmfd Mesh surface crossed
+   * @param azim_index the azimuthal angle index for the Track
+   * @param track_flux a pointer to the Track's angular flux
+   */
+  void tallySurfaceCurrent(int surface_id, int azim_index,
+                           FP_PRECISION* track_flux);
+  FP_PRECISION* loadBoundaryFlux(int track_id, bool direction,
+                                 FP_PRECISION* thread_flux);
+  void storeBoundaryFlux(int track_id, int azim_index, bool direction,
+                         FP_PRECISION* track_flux);
+  void tallyLeakage(int track_id, int azim_index, bool direction,
+                    FP_PRECISION* track_flux);
+  FP_PRECISION computeLeakage();
   void addSourceToScalarFlux();
   void computeKeff();
   void transportSweep();
+  void reduceContributions();
 
   /**
    * @brief Computes the exponential term in the transport equation for a
@@ -103,21 +419,135 @@ protected:
   virtual FP_PRECISION computeExponential(FP_PRECISION sigma_t,
                                           FP_PRECISION length, int p);
 
+  virtual void computeExponentials(int segment_id,
+                                   FP_PRECISION* stored_exponentials);
+
+  template <typename T>
+  const T* getExpTable();
+
+  template <typename T>
+  FP_PRECISION interpolateExponential(int index, FP_PRECISION tau, int p);
+
+  template <typename T>
+  void interpolateExponentials(int segment_id,
+                               FP_PRECISION* stored_exponentials);
+
 public:
   CPUSolver(Geometry* geometry=NULL, TrackGenerator* track_generator=NULL);
   virtual ~CPUSolver();
 
   int getNumThreads();
+  fluxUpdateType getFluxUpdateType();
+  sweepType getSweepType();
+  boundaryFluxPrecision getBoundaryFluxPrecision();
+  bool isStoringExponentials();
+  bool isStoringTauIndices();
+  double getExponentialsMemoryBudget();
+  double getReproducibleMemoryBudget();
+  int getNumTrackChunks();
+  double getLoadImbalance();
   FP_PRECISION getFSRScalarFlux(int fsr_id, int energy_group);
   FP_PRECISION* getFSRScalarFluxes();
   FP_PRECISION getFSRSource(int fsr_id, int energy_group);
   FP_PRECISION* getSurfaceCurrents();
 
   void setNumThreads(int num_threads);
+  void setFluxUpdateType(fluxUpdateType flux_update_type);
+  void setSweepType(sweepType sweep_type);
+  void setBoundaryFluxPrecision(boundaryFluxPrecision precision);
+  void setStoreExponentials(bool store_exponentials);
+  void setStoreTauIndices(bool store_tau_indices);
+  void setExponentialsMemoryBudget(double memory_budget);
+  void setReproducibleMemoryBudget(double memory_budget);
 
   void computeFSRFissionRates(double* fission_rates, int num_FSRs);
 
+  void printTimerReport();
+
 };
 
 
+/**
+ * @brief Returns the exponential linear interpolation table in single
+ *        precision.
+ * @return a pointer to the table, or NULL if it is in double precision
+ */
+template <>
+inline const float* CPUSolver::getExpTable<float>() {
+  return _exp_table_single;
+}
+
+
+/**
+ * @brief Returns the exponential linear interpolation table in double
+ *        precision.
+ * @return a pointer to the table, or NULL if it is in single precision
+ */
+template <>
+inline const double* CPUSolver::getExpTable<double>() {
+  return _exp_table_double;
+}
+
+
+/**
+ * @brief Evaluates the exponential in the transport equation with the
+ *        linear interpolation table.
+ * @details The slopes and intercepts are evaluated in the table's precision
+ *          T, which must match the precision of the table.
+ * @param index the table index of the optical length
+ * @param tau the optical length projected in the xy-plane
+ * @param p the polar angle index
+ * @return the interpolated exponential
+ */
+template <typename T>
+inline FP_PRECISION CPUSolver::interpolateExponential(int index,
+                                                      FP_PRECISION tau,
+                                                      int p) {
+
+  const T* exp_table = getExpTable<T>();
+  index = index * _two_times_num_polar + 2 * p;
+
+  return 1. - (exp_table[index] * tau + exp_table[index + 1]);
+}
+
+
+/**
+ * @brief Computes the exponentials in the transport equation for each
+ *        polar angle and energy group for a Track segment with the linear
+ *        interpolation table in precision T.
+ * @details The table index for each energy group is found once and reused
+ *          for each polar angle since the slopes and intercepts for the
+ *          polar angles are interleaved for each optical length. The index
+ *          is loaded from the stored tau indices if they were computed.
+ * @param segment_id the index of the segment in the flat segment arrays
+ * @param stored_exponentials the array to store the exponentials
+ */
+template <typename T>
+inline void CPUSolver::interpolateExponentials(int segment_id,
+                                   FP_PRECISION* stored_exponentials) {
+
+  FP_PRECISION length = _segment_lengths[segment_id];
+  FP_PRECISION* sigma_t =
+      _segment_sigma_t[_segment_material_indices[segment_id]];
+
+  uint16_t* tau_indices = NULL;
+  if (_tau_indices != NULL)
+    tau_indices = &_tau_indices[(long)segment_id*_num_groups];
+
+  for (int e=0; e < _num_groups; e++) {
+
+    FP_PRECISION tau = sigma_t[e] * length;
+    int index;
+
+    if (tau_indices != NULL)
+      index = tau_indices[e];
+    else
+      index = round_to_int(tau * _inverse_exp_table_spacing);
+
+    for (int p=0; p < _num_polar; p++)
+      stored_exponentials(p,e) = interpolateExponential<T>(index, tau, p);
+  }
+}
+
+
 #endif /* CPUSOLVER_H_ */
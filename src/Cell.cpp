@@ -416,6 +416,46 @@ bool Cell::cellContainsCoords(LocalCoords* coords) {
 }
 
 
+/**
+ * @brief Determines whether a Cell may overlap an axis-aligned box in the
+ *        xy-plane.
+ * @details The box does not overlap the Cell if it lies entirely on the
+ *          wrong side of one of the Cell's Surfaces. The test is
+ *          conservative and uses the same threshold as
+ *          Cell::cellContainsPoint(...), such that any Point in the box which
+ *          is contained by the Cell is guaranteed to return true.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return true if the Cell may overlap the box and false otherwise
+ */
+bool Cell::cellOverlapsBox(double min_x, double max_x,
+                           double min_y, double max_y) {
+
+  Surface* surface;
+  std::map<int, surface_halfspace>::iterator iter;
+
+  for (iter = _surfaces.begin(); iter != _surfaces.end(); ++iter) {
+    surface = iter->second._surface;
+
+    /* Return false if the box is outside the positive halfspace */
+    if (iter->second._halfspace == 1) {
+      if (surface->getMaxValue(min_x, max_x, min_y, max_y) <
+          -ON_SURFACE_THRESH)
+        return false;
+    }
+
+    /* Return false if the box is outside the negative halfspace */
+    else if (surface->getMinValue(min_x, max_x, min_y, max_y) >
+             ON_SURFACE_THRESH)
+      return false;
+  }
+
+  return true;
+}
+
+
 /**
  * @brief Computes the minimum distance to a Surface from a Point with a given
  *        trajectory at a certain angle.
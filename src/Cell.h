@@ -169,6 +169,8 @@ public:
 
   bool cellContainsPoint(Point* point);
   bool cellContainsCoords(LocalCoords* coords);
+  bool cellOverlapsBox(double min_x, double max_x,
+                       double min_y, double max_y);
   double minSurfaceDist(Point* point, double angle, Point* min_intersection);
   /**
    * @brief Convert this CellFill's attributes to a string format.
@@ -1739,16 +1739,17 @@ FP_PRECISION Cmfd::getFluxRatio(int cmfd_cell, int moc_group){
  *          With this approximation, the boundary fluxes are updated using
  *          the ratio of new to old flux for the cell that the outgoing flux
  *          from the track enters.
- * @param 2D array of Tracks
- * @param array of boundary fluxes
- * @return the number of Tracks
+ * @param tracks array of Tracks indexed by Track UID
+ * @param segment_offsets the offset of each Track's first segment into the
+ *        flat segment arrays
+ * @param segment_fsr_ids the flat array of segment FSR IDs
+ * @param boundary_flux array of boundary fluxes
+ * @param num_tracks the number of Tracks
  */
-void Cmfd::updateBoundaryFlux(Track** tracks, FP_PRECISION* boundary_flux,
-			      int num_tracks){
+void Cmfd::updateBoundaryFlux(Track** tracks, int* segment_offsets,
+                              int* segment_fsr_ids,
+                              FP_PRECISION* boundary_flux, int num_tracks){
 
-  segment* segments;
-  segment* curr_segment;
-  int num_segments;
   int bc;
   FP_PRECISION* track_flux;
   FP_PRECISION ratio;
@@ -1759,14 +1760,10 @@ void Cmfd::updateBoundaryFlux(Track** tracks, FP_PRECISION* boundary_flux,
   /* Loop over Tracks */
   for (int i=0; i < num_tracks; i++) {
 
-    num_segments = tracks[i]->getNumSegments();
-    segments = tracks[i]->getSegments();
-
     /* Update boundary flux in forward direction */
     bc = (int)tracks[i]->getBCOut();
-    curr_segment = &segments[0];
     track_flux = &boundary_flux[i*2*_num_moc_groups*_num_polar];
-    cmfd_cell = convertFSRIdToCmfdCell(curr_segment->_region_id);
+    cmfd_cell = convertFSRIdToCmfdCell(segment_fsr_ids[segment_offsets[i]]);
 
     if (bc){
       for (int e=0; e < _num_moc_groups; e++) {
@@ -1778,7 +1775,6 @@ void Cmfd::updateBoundaryFlux(Track** tracks, FP_PRECISION* boundary_flux,
 
     /* Update boundary flux in backwards direction */
     bc = (int)tracks[i]->getBCIn();
-    curr_segment = &segments[num_segments-1];
     track_flux = &boundary_flux[(i*2 + 1)*_num_moc_groups*_num_polar];
 
     if (bc){
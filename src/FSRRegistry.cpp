@@ -0,0 +1,368 @@
+#include "FSRRegistry.h"
+
+
+/**
+ * @brief Constructor initializes an empty FSRRegistry with the lock for each
+ *        shard.
+ */
+FSRRegistry::FSRRegistry() {
+
+  _num_FSRs = 0;
+  _num_collisions = 0;
+  _shards = new fsr_shard[NUM_FSR_SHARDS];
+
+  for (int s=0; s < NUM_FSR_SHARDS; s++)
+    omp_init_lock(&_shards[s]._lock);
+}
+
+
+/**
+ * @brief Destructor deletes the characteristic points, shards and locks.
+ */
+FSRRegistry::~FSRRegistry() {
+
+  clear();
+
+  for (int s=0; s < NUM_FSR_SHARDS; s++)
+    omp_destroy_lock(&_shards[s]._lock);
+
+  delete [] _shards;
+}
+
+
+/**
+ * @brief Returns the number of FSRs in the registry.
+ * @return the number of FSRs
+ */
+int FSRRegistry::getNumFSRs() {
+  return _num_FSRs;
+}
+
+
+/**
+ * @brief Returns the number of FSRs whose key hash is shared with another
+ *        FSR.
+ * @details Such hash collisions are resolved by comparing the full keys.
+ * @return the number of FSRs with colliding key hashes
+ */
+int FSRRegistry::getNumCollisions() {
+  return _num_collisions;
+}
+
+
+/**
+ * @brief Finds the fsr_data struct for an FSR key in a shard.
+ * @details Each FSR with the key's hash is compared with the full key such
+ *          that FSRs with colliding hashes are never merged. The caller must
+ *          hold the shard's lock.
+ * @param shard the shard holding the key's hash
+ * @param key the packed FSR key
+ * @return a pointer to the fsr_data struct or NULL if it is not found
+ */
+fsr_data* FSRRegistry::findFSRData(fsr_shard* shard, fsr_key* key) {
+
+  std::pair<std::unordered_multimap<std::size_t, fsr_data>::iterator,
+            std::unordered_multimap<std::size_t, fsr_data>::iterator> range;
+  range = shard->_FSR_keys_map.equal_range(key->_hash);
+
+  for (; range.first != range.second; ++range.first) {
+    std::vector<int>& values = range.first->second._key;
+    if ((int)values.size() == key->_length &&
+        std::equal(values.begin(), values.end(), key->_values))
+      return &range.first->second;
+  }
+
+  return NULL;
+}
+
+
+/**
+ * @brief Returns the FSR ID for an FSR key.
+ * @details This method is thread safe and may be called while other threads
+ *          insert FSRs.
+ * @param key the packed FSR key
+ * @return the FSR ID or -1 if the FSR is not in the registry
+ */
+int FSRRegistry::findFSRId(fsr_key* key) {
+
+  fsr_shard* shard = getShard(key->_hash);
+  int fsr_id = -1;
+
+  omp_set_lock(&shard->_lock);
+
+  fsr_data* fsr = findFSRData(shard, key);
+  if (fsr != NULL)
+    fsr_id = fsr->_fsr_id;
+
+  omp_unset_lock(&shard->_lock);
+
+  return fsr_id;
+}
+
+
+/**
+ * @brief Inserts an FSR into the registry if it has not yet been found.
+ * @details This method is thread safe. Only the shard which holds the key is
+ *          locked, such that threads finding FSRs in different shards do not
+ *          wait on each other. New FSRs receive provisional FSR IDs in order
+ *          of discovery until renumberFSRs() is called.
+ * @param key the packed FSR key
+ * @param x the x-coordinate of the characteristic point in the FSR
+ * @param y the y-coordinate of the characteristic point in the FSR
+ * @param material_id the ID of the Material filling the FSR
+ * @return the FSR ID
+ */
+int FSRRegistry::insertFSR(fsr_key* key, double x, double y,
+                           int material_id) {
+
+  fsr_shard* shard = getShard(key->_hash);
+  int fsr_id;
+
+  omp_set_lock(&shard->_lock);
+
+  /* Recheck whether another thread inserted the FSR */
+  fsr_data* fsr = findFSRData(shard, key);
+
+  if (fsr != NULL)
+    fsr_id = fsr->_fsr_id;
+
+  else {
+
+    #pragma omp atomic capture
+    fsr_id = _num_FSRs++;
+
+    if (shard->_FSR_keys_map.count(key->_hash) > 0) {
+      #pragma omp atomic
+      _num_collisions++;
+    }
+
+    fsr_data new_fsr;
+    new_fsr._fsr_id = fsr_id;
+    new_fsr._point = new Point();
+    new_fsr._point->setCoords(x, y);
+    new_fsr._material_id = material_id;
+    new_fsr._key.assign(key->_values, key->_values + key->_length);
+    shard->_FSR_keys_map.insert(std::make_pair(key->_hash, new_fsr));
+  }
+
+  omp_unset_lock(&shard->_lock);
+
+  return fsr_id;
+}
+
+
+/**
+ * @brief Adds an FSR with a known FSR ID to the registry.
+ * @details This method is used when the FSRs are read from a Track file
+ *          and is not thread safe.
+ * @param key the packed FSR key
+ * @param fsr_id the FSR ID
+ * @param x the x-coordinate of the characteristic point in the FSR
+ * @param y the y-coordinate of the characteristic point in the FSR
+ * @param material_id the ID of the Material filling the FSR
+ */
+void FSRRegistry::addFSR(fsr_key* key, int fsr_id, double x, double y,
+                         int material_id) {
+
+  fsr_shard* shard = getShard(key->_hash);
+  fsr_data* existing_fsr = findFSRData(shard, key);
+
+  if (existing_fsr != NULL)
+    log_printf(ERROR, "Unable to add FSR %d to the registry since its key "
+               "is already used by FSR %d", fsr_id, existing_fsr->_fsr_id);
+
+  if (shard->_FSR_keys_map.count(key->_hash) > 0)
+    _num_collisions++;
+
+  std::unordered_multimap<std::size_t, fsr_data>::iterator iter =
+       shard->_FSR_keys_map.insert(std::make_pair(key->_hash, fsr_data()));
+  fsr_data& fsr = iter->second;
+  fsr._fsr_id = fsr_id;
+  fsr._point = new Point();
+  fsr._point->setCoords(x, y);
+  fsr._material_id = material_id;
+  fsr._key.assign(key->_values, key->_values + key->_length);
+
+  if (fsr_id >= _num_FSRs) {
+    _num_FSRs = fsr_id + 1;
+    _FSRs_to_keys.resize(_num_FSRs);
+    _FSRs_to_data.resize(_num_FSRs, NULL);
+  }
+
+  _FSRs_to_keys.at(fsr_id) = key->_hash;
+  _FSRs_to_data.at(fsr_id) = &fsr;
+}
+
+
+/**
+ * @brief Compares two FSRs by their packed keys.
+ * @param a the fsr_data struct of the first FSR
+ * @param b the fsr_data struct of the second FSR
+ * @return whether the first FSR key precedes the second FSR key
+ */
+static bool compare_fsr_keys(const fsr_data* a, const fsr_data* b) {
+  return a->_key < b->_key;
+}
+
+
+/**
+ * @brief Returns new FSR IDs which order the FSRs by their path through the
+ *        CSG hierarchy.
+ * @details The FSRs are sorted lexicographically by their packed keys, such
+ *          that FSRs in the same CMFD cell, Lattice cell and Universe have
+ *          consecutive FSR IDs. The order only depends on the Geometry and
+ *          not on the Tracks or the scheduling of the threads.
+ * @return a vector of the new FSR IDs indexed by the current FSR IDs
+ */
+std::vector<int> FSRRegistry::getCSGPathOrder() {
+
+  std::vector<fsr_data*> fsrs;
+  std::unordered_multimap<std::size_t, fsr_data>::iterator iter;
+  std::vector<int> new_fsr_ids(_num_FSRs, -1);
+
+  fsrs.reserve(_num_FSRs);
+
+  for (int s=0; s < NUM_FSR_SHARDS; s++) {
+    std::unordered_multimap<std::size_t, fsr_data>& map =
+         _shards[s]._FSR_keys_map;
+    for (iter = map.begin(); iter != map.end(); ++iter)
+      fsrs.push_back(&iter->second);
+  }
+
+  std::sort(fsrs.begin(), fsrs.end(), compare_fsr_keys);
+
+  for (int r=0; r < _num_FSRs; r++)
+    new_fsr_ids.at(fsrs[r]->_fsr_id) = r;
+
+  return new_fsr_ids;
+}
+
+
+/**
+ * @brief Assigns new FSR IDs to the FSRs in the registry.
+ * @details The provisional FSR IDs depend on the order in which threads
+ *          discover the FSRs during ray tracing. This method applies a
+ *          permutation of the FSR IDs, ie, from getCSGPathOrder(), and
+ *          builds the arrays indexed by FSR ID. The caller must apply the
+ *          same permutation to the FSR IDs stored elsewhere, ie, in the
+ *          Track segments. This method is not thread safe.
+ * @param new_fsr_ids a vector of the new FSR IDs indexed by the current
+ *        FSR IDs
+ */
+void FSRRegistry::renumberFSRs(std::vector<int>& new_fsr_ids) {
+
+  std::unordered_multimap<std::size_t, fsr_data>::iterator iter;
+
+  if ((int)new_fsr_ids.size() != _num_FSRs)
+    log_printf(ERROR, "Unable to renumber %d FSRs with %d new FSR IDs",
+               _num_FSRs, (int)new_fsr_ids.size());
+
+  _FSRs_to_keys.assign(_num_FSRs, 0);
+  _FSRs_to_data.assign(_num_FSRs, NULL);
+
+  for (int s=0; s < NUM_FSR_SHARDS; s++) {
+    std::unordered_multimap<std::size_t, fsr_data>& map =
+         _shards[s]._FSR_keys_map;
+
+    for (iter = map.begin(); iter != map.end(); ++iter) {
+      int fsr_id = new_fsr_ids.at(iter->second._fsr_id);
+
+      if (fsr_id < 0 || fsr_id >= _num_FSRs || _FSRs_to_data[fsr_id] != NULL)
+        log_printf(ERROR, "Unable to renumber the FSRs since the new FSR IDs "
+                   "are not a permutation of the current FSR IDs");
+
+      iter->second._fsr_id = fsr_id;
+      _FSRs_to_keys[fsr_id] = iter->first;
+      _FSRs_to_data[fsr_id] = &iter->second;
+    }
+  }
+
+  if (_num_collisions > 0)
+    log_printf(INFO, "Resolved %d FSR key hash collisions", _num_collisions);
+}
+
+
+/**
+ * @brief Removes all FSRs from the registry.
+ */
+void FSRRegistry::clear() {
+
+  std::unordered_multimap<std::size_t, fsr_data>::iterator iter;
+
+  for (int s=0; s < NUM_FSR_SHARDS; s++) {
+    std::unordered_multimap<std::size_t, fsr_data>& map =
+         _shards[s]._FSR_keys_map;
+    for (iter = map.begin(); iter != map.end(); ++iter)
+      delete iter->second._point;
+    map.clear();
+  }
+
+  _FSRs_to_keys.clear();
+  _FSRs_to_data.clear();
+  _num_FSRs = 0;
+  _num_collisions = 0;
+}
+
+
+/**
+ * @brief Returns the key hash for an FSR ID.
+ * @param fsr_id the FSR ID
+ * @return the FSR key hash
+ */
+std::size_t FSRRegistry::getFSRKey(int fsr_id) {
+
+  if (fsr_id < 0 || fsr_id >= (int)_FSRs_to_keys.size())
+    log_printf(ERROR, "Unable to return the key for FSR %d since the "
+               "registry has %d numbered FSRs", fsr_id,
+               (int)_FSRs_to_keys.size());
+
+  return _FSRs_to_keys[fsr_id];
+}
+
+
+/**
+ * @brief Returns the integers in the packed key for an FSR ID.
+ * @param fsr_id the FSR ID
+ * @return a reference to the vector of integers in the FSR key
+ */
+std::vector<int>& FSRRegistry::getFSRKeyValues(int fsr_id) {
+
+  if (fsr_id < 0 || fsr_id >= (int)_FSRs_to_data.size())
+    log_printf(ERROR, "Unable to return the key for FSR %d since the "
+               "registry has %d numbered FSRs", fsr_id,
+               (int)_FSRs_to_data.size());
+
+  return _FSRs_to_data[fsr_id]->_key;
+}
+
+
+/**
+ * @brief Returns the characteristic point for an FSR ID.
+ * @param fsr_id the FSR ID
+ * @return a pointer to the FSR's characteristic point
+ */
+Point* FSRRegistry::getFSRPoint(int fsr_id) {
+
+  if (fsr_id < 0 || fsr_id >= (int)_FSRs_to_data.size())
+    log_printf(ERROR, "Unable to return the point for FSR %d since the "
+               "registry has %d numbered FSRs", fsr_id,
+               (int)_FSRs_to_data.size());
+
+  return _FSRs_to_data[fsr_id]->_point;
+}
+
+
+/**
+ * @brief Returns the ID of the Material filling an FSR.
+ * @param fsr_id the FSR ID
+ * @return the Material ID
+ */
+int FSRRegistry::getFSRMaterialId(int fsr_id) {
+
+  if (fsr_id < 0 || fsr_id >= (int)_FSRs_to_data.size())
+    log_printf(ERROR, "Unable to return the Material for FSR %d since the "
+               "registry has %d numbered FSRs", fsr_id,
+               (int)_FSRs_to_data.size());
+
+  return _FSRs_to_data[fsr_id]->_material_id;
+}
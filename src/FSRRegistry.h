@@ -0,0 +1,201 @@
+/**
+ * @file FSRRegistry.h
+ * @brief The FSRRegistry class.
+ * @details The FSRRegistry maps the keys of the flat source regions to
+ *          unique FSR IDs, characteristic points and Material IDs. The keys
+ *          are packed integer descriptions of the CMFD cell, Lattice cells,
+ *          Universes and Cell containing each FSR and are distributed across
+ *          shards by their hash. Each shard is guarded by its own lock such
+ *          that threads may discover FSRs concurrently during ray tracing.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+#ifndef FSRREGISTRY_H_
+#define FSRREGISTRY_H_
+
+#ifdef __cplusplus
+#include <omp.h>
+#include <vector>
+#include <algorithm>
+#include <unordered_map>
+#include <stdint.h>
+#include "Point.h"
+#include "log.h"
+#endif
+
+
+/** The number of shards in the FSRRegistry, each with its own lock */
+#define NUM_FSR_SHARDS 64
+
+/** The maximum number of integers in a packed FSR key */
+#define MAX_FSR_KEY_LENGTH 64
+
+
+/**
+ * @struct fsr_key
+ * @brief A fsr_key struct uniquely identifies an FSR by the integers which
+ *        describe its path through the CSG hierarchy.
+ * @details The key is built on the stack for each segment during ray
+ *          tracing, such that no strings or heap allocations are needed to
+ *          look up the FSR.
+ */
+struct fsr_key {
+
+  /** The number of integers in the key */
+  int _length;
+
+  /** The hash of the integers in the key */
+  std::size_t _hash;
+
+  /** The CMFD cell, Lattice cells, Universe IDs and Cell ID of the FSR */
+  int _values[MAX_FSR_KEY_LENGTH];
+};
+
+
+/**
+ * @brief Appends an integer to a packed FSR key.
+ * @param key the FSR key
+ * @param value the integer to append
+ */
+inline void append_fsr_key(fsr_key* key, int value) {
+
+  if (key->_length == MAX_FSR_KEY_LENGTH)
+    log_printf(ERROR, "Unable to build an FSR key with more than %d "
+               "integers. Increase MAX_FSR_KEY_LENGTH for deeply nested "
+               "geometries.", MAX_FSR_KEY_LENGTH);
+
+  key->_values[key->_length++] = value;
+}
+
+
+/**
+ * @brief Computes the hash of the integers in a packed FSR key.
+ * @details The integers are combined with the 64-bit FNV-1a hash and the
+ *          result is mixed with the finalizer from MurmurHash3 such that the
+ *          low order bits used to select the shard are well distributed.
+ * @param key the FSR key
+ */
+inline void hash_fsr_key(fsr_key* key) {
+
+  uint64_t hash = 14695981039346656037ULL;
+
+  for (int i=0; i < key->_length; i++) {
+    hash ^= (uint32_t)key->_values[i];
+    hash *= 1099511628211ULL;
+  }
+
+  hash ^= hash >> 33;
+  hash *= 0xff51afd7ed558ccdULL;
+  hash ^= hash >> 33;
+  hash *= 0xc4ceb9fe1a85ec53ULL;
+  hash ^= hash >> 33;
+
+  key->_hash = (std::size_t)hash;
+}
+
+
+/**
+ * @struct fsr_data
+ * @brief A fsr_data struct represents an FSR with a unique FSR ID
+ *        and a characteristic point that lies within the FSR that
+ *        can be used to recompute the hierarchical LocalCoords
+ *        linked list.
+ */
+struct fsr_data {
+
+  /** The FSR ID */
+  int _fsr_id;
+
+  /** Characteristic point in Universe 0 that lies in FSR */
+  Point* _point;
+
+  /** The ID of the Material filling the FSR */
+  int _material_id;
+
+  /** The integers in the FSR's packed key */
+  std::vector<int> _key;
+};
+
+
+/**
+ * @struct fsr_shard
+ * @brief A fsr_shard is one partition of the FSRRegistry's hash table.
+ */
+struct fsr_shard {
+
+  /** The lock guarding the shard's map */
+  omp_lock_t _lock;
+
+  /** A map of FSR key hashes to fsr_data structs. FSRs whose keys have
+   *  the same hash share an entry in the map. */
+  std::unordered_multimap<std::size_t, fsr_data> _FSR_keys_map;
+
+  /** Padding to keep the locks of neighboring shards on separate cache
+   *  lines */
+  char _padding[64];
+};
+
+
+/**
+ * @class FSRRegistry FSRRegistry.h "src/FSRRegistry.h"
+ * @brief A concurrent registry of the flat source regions in the Geometry.
+ * @details FSRs are inserted by the threads which first find them during
+ *          ray tracing and receive provisional FSR IDs in order of
+ *          discovery. Once ray tracing completes, renumberFSRs() assigns
+ *          the final FSR IDs, ie, in a canonical order which does not depend
+ *          on the scheduling of the threads, and builds the arrays indexed
+ *          by FSR ID.
+ */
+class FSRRegistry {
+
+private:
+
+  /** The shards of the hash table */
+  fsr_shard* _shards;
+
+  /** The number of FSRs in the registry */
+  int _num_FSRs;
+
+  /** The number of FSRs whose key hash is shared with another FSR */
+  int _num_collisions;
+
+  /** The FSR key hashes indexed by FSR ID */
+  std::vector<std::size_t> _FSRs_to_keys;
+
+  /** Pointers to the fsr_data structs indexed by FSR ID */
+  std::vector<fsr_data*> _FSRs_to_data;
+
+  /**
+   * @brief Returns the shard which holds an FSR key hash.
+   * @param key the FSR key hash
+   * @return a pointer to the shard
+   */
+  fsr_shard* getShard(std::size_t key) {
+    return &_shards[key % NUM_FSR_SHARDS];
+  }
+
+  fsr_data* findFSRData(fsr_shard* shard, fsr_key* key);
+
+public:
+
+  FSRRegistry();
+  virtual ~FSRRegistry();
+
+  int getNumFSRs();
+  int getNumCollisions();
+  int findFSRId(fsr_key* key);
+  int insertFSR(fsr_key* key, double x, double y, int material_id);
+  void addFSR(fsr_key* key, int fsr_id, double x, double y,
+              int material_id);
+  std::vector<int> getCSGPathOrder();
+  void renumberFSRs(std::vector<int>& new_fsr_ids);
+  void clear();
+
+  std::size_t getFSRKey(int fsr_id);
+  std::vector<int>& getFSRKeyValues(int fsr_id);
+  Point* getFSRPoint(int fsr_id);
+  int getFSRMaterialId(int fsr_id);
+};
+
+#endif /* FSRREGISTRY_H_ */
@@ -18,31 +18,21 @@ void reset_auto_ids() {
  */
 Geometry::Geometry() {
 
-  _num_FSRs = 0;
-
   _max_seg_length = 0;
   _min_seg_length = std::numeric_limits<double>::infinity();
 
   /* Initialize CMFD object to NULL */
   _cmfd = NULL;
 
-  /* initialize _num_FSRs lock */
-  _num_FSRs_lock = new omp_lock_t;
-  omp_init_lock(_num_FSRs_lock);
+  _FSR_registry = new FSRRegistry();
 }
 
 
 /**
- * @brief Destructor clears FSR to Cells and Materials maps.
+ * @brief Destructor deletes the FSR registry.
  */
 Geometry::~Geometry() {
-
-  /* Free FSR  maps if they were initialized */
-  if (_num_FSRs != 0) {
-    _FSR_keys_map.clear();
-    _FSRs_to_keys.clear();
-    _FSRs_to_material_IDs.clear();
-  }
+  delete _FSR_registry;
 }
 
 
@@ -183,16 +173,7 @@ boundaryType Geometry::getMaxZBoundaryType() {
  * @return number of FSRs
  */
 int Geometry::getNumFSRs() {
-  return _num_FSRs;
-}
-
-
-/**
- * @brief Sets the number of flat source regions (FSRs) in the Geometry.
- * @param num_fsrs number of FSRs
- */
-void Geometry::setNumFSRs(int num_fsrs) {
-  _num_FSRs = num_fsrs;
+  return _FSR_registry->getNumFSRs();
 }
 
 
@@ -431,9 +412,9 @@ CellBasic* Geometry::findFirstCell(LocalCoords* coords, double angle) {
 
 /**
  * @brief Find the Material for a flat source region ID.
- * @details  This method finds the fsr_id within the
- *           _FSR_to_material_IDs map and returns the corresponding
- *           pointer to the Material object.
+ * @details  This method finds the Material ID for the fsr_id within the
+ *           FSR registry and returns the corresponding pointer to the
+ *           Material object.
  * @param fsr_id a FSR id
  * @return a pointer to the Material that this FSR is in
  */
@@ -446,7 +427,7 @@ Material* Geometry::findFSRMaterial(int fsr_id) {
   else
     all_materials = _all_materials;
 
-  return all_materials[_FSRs_to_material_IDs.at(fsr_id)];
+  return all_materials[_FSR_registry->getFSRMaterialId(fsr_id)];
 }
 
 
@@ -534,62 +515,30 @@ CellBasic* Geometry::findNextCell(LocalCoords* coords, double angle) {
 /**
  * @brief Find and return the ID of the flat source region that a given
  *        LocalCoords object resides within.
+ * @details If the FSR has not been encountered it is inserted into the FSR
+ *          registry. This method is thread safe. The FSR IDs are provisional
+ *          until renumberFSRs() is called after ray tracing.
  * @param coords a LocalCoords object pointer
  * @return the FSR ID for a given LocalCoords object
  */
 int Geometry::findFSRId(LocalCoords* coords) {
 
-  int fsr_id = 0;
-  LocalCoords* curr = coords;
-  curr = coords->getLowestLevel();
-  std::hash<std::string> key_hash_function;
-
   /* Generate unique FSR key */
-  std::size_t fsr_key_hash = key_hash_function(getFSRKey(coords));
-
-  /* If FSR has not been encountered, update FSR maps and vectors */
-  if (_FSR_keys_map.find(fsr_key_hash) == _FSR_keys_map.end()){
-
-    /* Get the cell that contains coords */
-    CellBasic* cell = findCellContainingCoords(curr);
-
-    /* Get the lock */
-    omp_set_lock(_num_FSRs_lock);
-
-    /* Recheck to see if FSR has been added to maps after getting the lock */
-    if (_FSR_keys_map.find(fsr_key_hash) != _FSR_keys_map.end())
-      fsr_id = _FSR_keys_map.at(fsr_key_hash)._fsr_id;
-    else{
-
-        /* Add FSR information to FSR key map and FSR_to vectors */
-      fsr_id = _num_FSRs;
-      fsr_data* fsr = new fsr_data;
-      fsr->_fsr_id = fsr_id;
-      Point* point = new Point();
-      point->setCoords(coords->getHighestLevel()->getX(),
-                       coords->getHighestLevel()->getY());
-      fsr->_point = point;
-      _FSR_keys_map[fsr_key_hash] = *fsr;
-      _FSRs_to_keys.push_back(fsr_key_hash);
-      _FSRs_to_material_IDs.push_back(cell->getMaterial()->getId());
-
-      /* If CMFD acceleration is on, add FSR to CMFD cell */
-      if (_cmfd != NULL){
-        int cmfd_cell = _cmfd->findCmfdCell(coords->getHighestLevel());
-        _cmfd->addFSRToCell(cmfd_cell, fsr_id);
-      }
-
-      /* Increment FSR counter */
-      _num_FSRs++;
-    }
-
-    /* Release lock */
-    omp_unset_lock(_num_FSRs_lock);
-
+  fsr_key key;
+  packFSRKey(coords, &key);
+
+  /* If FSR has already been encountered, get the FSR ID from the registry */
+  int fsr_id = _FSR_registry->findFSRId(&key);
+
+  /* Otherwise insert the FSR in the registry with the Material of the cell
+   * containing coords and a characteristic point */
+  if (fsr_id == -1) {
+    CellBasic* cell = findCellContainingCoords(coords->getLowestLevel());
+    fsr_id = _FSR_registry->insertFSR(&key,
+                                      coords->getHighestLevel()->getX(),
+                                      coords->getHighestLevel()->getY(),
+                                      cell->getMaterial()->getId());
   }
-  /* If FSR has already been encountered, get the fsr id from map */
-  else
-    fsr_id = _FSR_keys_map.at(fsr_key_hash)._fsr_id;
 
   return fsr_id;
 }
@@ -603,19 +552,14 @@ int Geometry::findFSRId(LocalCoords* coords) {
  */
 int Geometry::getFSRId(LocalCoords* coords) {
 
-  int fsr_id = 0;
-  std::string fsr_key;
-  std::hash<std::string> key_hash_function;
+  fsr_key key;
+  packFSRKey(coords, &key);
+  int fsr_id = _FSR_registry->findFSRId(&key);
 
-  try{
-    fsr_key = getFSRKey(coords);
-    fsr_id = _FSR_keys_map.at(key_hash_function(fsr_key))._fsr_id;
-  }
-  catch(std::exception &e) {
+  if (fsr_id == -1)
     log_printf(ERROR, "Could not find FSR ID with key: %s. Try creating "
-               "geometry with finer track laydown. "
-               "Backtrace:%s", fsr_key.c_str(), e.what());
-  }
+               "geometry with finer track laydown.",
+               getFSRKey(coords).c_str());
 
   return fsr_id;
 }
@@ -627,18 +571,57 @@ int Geometry::getFSRId(LocalCoords* coords) {
  * @return the FSR's characteristic point
  */
 Point* Geometry::getFSRPoint(int fsr_id) {
+  return _FSR_registry->getFSRPoint(fsr_id);
+}
 
-  Point* point;
 
-  try{
-    point = _FSR_keys_map.at(_FSRs_to_keys.at(fsr_id))._point;
+/**
+ * @brief Packs the integers that identify an FSR by its unique hierarchical
+ *        lattice/universe/cell structure into an FSR key.
+ * @details The key holds the same information as the string returned by
+ *          getFSRKey(), ie, the CMFD cell if CMFD is on, the ID and cell
+ *          indices of each Lattice or the ID of each Universe in the
+ *          hierarchy and the ID of the lowest level Cell. Each level is
+ *          tagged with its coordinate type. The key is built without any
+ *          string formatting or heap allocation, and its hash is computed.
+ * @param coords a LocalCoords object pointer
+ * @param key a pointer to the FSR key to fill
+ */
+void Geometry::packFSRKey(LocalCoords* coords, fsr_key* key) {
+
+  LocalCoords* curr = coords->getHighestLevel();
+  key->_length = 0;
+
+  /* If CMFD is on, write the CMFD lattice cell to the key */
+  if (_cmfd != NULL) {
+    append_fsr_key(key, _cmfd->getLattice()->getLatX(curr->getPoint()));
+    append_fsr_key(key, _cmfd->getLattice()->getLatY(curr->getPoint()));
   }
-  catch(std::exception &e) {
-    log_printf(ERROR, "Could not find characteristic point in FSR: %i. "
-               "Backtrace:%s", fsr_id, e.what());
+
+  /* Descend the linked list hierarchy until the lowest level has
+   * been reached */
+  while (curr != NULL) {
+
+    append_fsr_key(key, curr->getType());
+
+    if (curr->getType() == LAT) {
+      append_fsr_key(key, curr->getLattice()->getId());
+      append_fsr_key(key, curr->getLatticeX());
+      append_fsr_key(key, curr->getLatticeY());
+    }
+    else
+      append_fsr_key(key, curr->getUniverse()->getId());
+
+    if (curr->getNext() == NULL)
+      break;
+    else
+      curr = curr->getNext();
   }
 
-  return point;
+  /* Write the Cell ID to the key */
+  append_fsr_key(key, curr->getCell()->getId());
+
+  hash_fsr_key(key);
 }
 
 
@@ -649,7 +632,9 @@ Point* Geometry::getFSRPoint(int fsr_id) {
  *          level and Cells might overlap other cells, it is important to
  *          have a method for uniquely identifying FSRs. This method
  *          creates a unique FSR key by constructing a structured string
- *          that describes the hierarchy of lattices/universes/cells.
+ *          that describes the hierarchy of lattices/universes/cells. The
+ *          string is intended for debugging; ray tracing identifies FSRs by
+ *          the packed integer keys from packFSRKey().
  * @param coords a LocalCoords object pointer
  * @return the FSR key
  */
@@ -742,14 +727,25 @@ void Geometry::subdivideCells() {
  *        initialize CMFD.
  * @details This method is intended to be called by the user before initiating
  *          source iteration. This method first subdivides all Cells by calling
- *          the Geometry::subdivideCells() method. Then it initializes the CMFD
- *          object.
+ *          the Geometry::subdivideCells() method and bins the Cells in each
+ *          Universe. Then it initializes the CMFD object.
  */
 void Geometry::initializeFlatSourceRegions() {
 
   /* Subdivide Cells into sectors and rings */
   subdivideCells();
 
+  /* Bin the Cells in each Universe to accelerate the search for Cells */
+  std::map<int, Universe*> all_universes = _root_universe->getAllUniverses();
+  std::map<int, Universe*>::iterator iter;
+
+  all_universes[_root_universe->getId()] = _root_universe;
+
+  for (iter = all_universes.begin(); iter != all_universes.end(); ++iter) {
+    if (iter->second->getType() == SIMPLE)
+      iter->second->buildCellBins();
+  }
+
   /* Create map of Material IDs to Material pointers */
   _all_materials = getAllMaterials();
 
@@ -785,6 +781,10 @@ void Geometry::segmentize(Track* track, FP_PRECISION max_optical_length) {
   int num_segments;
   int num_groups;
 
+  /* The max and min segment lengths along this Track */
+  double max_seg_length = 0;
+  double min_seg_length = std::numeric_limits<double>::infinity();
+
   /* Use a LocalCoords for the start and end of each segment */
   LocalCoords segment_start(x0, y0);
   LocalCoords segment_end(x0, y0);
@@ -850,10 +850,10 @@ void Geometry::segmentize(Track* track, FP_PRECISION max_optical_length) {
       new_segment->_length = segment_length / FP_PRECISION(min_num_segments);
 
       /* Update the max and min segment lengths */
-      if (segment_length > _max_seg_length)
-        _max_seg_length = segment_length;
-      if (segment_length < _min_seg_length)
-        _min_seg_length = segment_length;
+      if (segment_length > max_seg_length)
+        max_seg_length = segment_length;
+      if (segment_length < min_seg_length)
+        min_seg_length = segment_length;
 
       log_printf(DEBUG, "segment start x = %f, y = %f, segment end "
                  "x = %f, y = %f", segment_start.getX(), segment_start.getY(),
@@ -898,6 +898,14 @@ void Geometry::segmentize(Track* track, FP_PRECISION max_optical_length) {
     }
   }
 
+  /* Update the Geometry's max and min segment lengths since Tracks may be
+   * segmentized by several threads at once */
+  #pragma omp critical (segment_lengths)
+  {
+    _max_seg_length = std::max(_max_seg_length, max_seg_length);
+    _min_seg_length = std::min(_min_seg_length, min_seg_length);
+  }
+
   log_printf(DEBUG, "Created %d segments for Track: %s",
              track->getNumSegments(), track->toString().c_str());
 
@@ -1073,20 +1081,27 @@ void Geometry::initializeCmfd(){
 
 
 /**
- * @brief Returns the map that maps FSR keys to FSR IDs
- * @return _FSR_keys_map map of FSR keys to FSR IDs
+ * @brief Returns the registry of the FSRs in the Geometry.
+ * @return a pointer to the FSR registry
  */
-std::unordered_map<std::size_t, fsr_data> Geometry::getFSRKeysMap(){
-  return _FSR_keys_map;
+FSRRegistry* Geometry::getFSRRegistry() {
+  return _FSR_registry;
 }
 
 
 /**
  * @brief Returns the vector that maps FSR IDs to FSR key hashes
- * @return _FSR_keys_map map of FSR keys to FSR IDs
+ * @return a vector of FSR key hashes indexed by FSR ID
  */
 std::vector<std::size_t> Geometry::getFSRsToKeys(){
-  return _FSRs_to_keys;
+
+  int num_FSRs = _FSR_registry->getNumFSRs();
+  std::vector<std::size_t> FSRs_to_keys(num_FSRs);
+
+  for (int r=0; r < num_FSRs; r++)
+    FSRs_to_keys[r] = _FSR_registry->getFSRKey(r);
+
+  return FSRs_to_keys;
 }
 
 
@@ -1096,45 +1111,48 @@ std::vector<std::size_t> Geometry::getFSRsToKeys(){
  * @return an integer vector of FSR-to-Material IDs indexed by FSR ID
  */
 std::vector<int> Geometry::getFSRsToMaterialIDs() {
-  if (_num_FSRs == 0)
+
+  int num_FSRs = _FSR_registry->getNumFSRs();
+  std::vector<int> FSRs_to_material_IDs(num_FSRs);
+
+  if (num_FSRs == 0)
     log_printf(ERROR, "Unable to return the FSR-to-Material map array since "
                "the Geometry has not initialized FSRs.");
 
-  return _FSRs_to_material_IDs;
+  for (int r=0; r < num_FSRs; r++)
+    FSRs_to_material_IDs[r] = _FSR_registry->getFSRMaterialId(r);
+
+  return FSRs_to_material_IDs;
 }
 
 
 /**
- * @brief Sets the _FSR_keys_map map
- * @details The _FSR_keys_map stores a hash of a std::string representing
- *          the Lattice/Cell/Universe hierarchy for a unique region
- *          and the associated FSR data. fsr_data is a struct that contains
- *          a unique FSR id and a Point located in the highest level Universe
- *          that is contained in the FSR. This method is used when the tracks
- *          are read from file to avoid unnecessary segmentation.
- * @param FSR_keys_map map of FSR keys to FSR data
+ * @brief Assigns the final FSR IDs after ray tracing.
+ * @details The FSR registry applies the new FSR IDs, ie, in a canonical
+ *          order which is independent of the order in which threads
+ *          discovered the FSRs during ray tracing. If CMFD acceleration is
+ *          on, each FSR is then added to the CMFD cell containing its
+ *          characteristic point.
+ * @param new_fsr_ids a vector of the new FSR IDs indexed by the provisional
+ *        FSR IDs
  */
-void Geometry::setFSRKeysMap(std::unordered_map<std::size_t, fsr_data>
-                             FSR_keys_map){
-  _FSR_keys_map = FSR_keys_map;
-}
+void Geometry::renumberFSRs(std::vector<int>& new_fsr_ids) {
 
+  _FSR_registry->renumberFSRs(new_fsr_ids);
 
-/**
- * @brief Sets the _FSRs_to_keys vector
- * @param FSRs_to_keys vector of FSR key hashes indexed by FSR IDs
- */
-void Geometry::setFSRsToKeys(std::vector<std::size_t> FSRs_to_keys){
-  _FSRs_to_keys = FSRs_to_keys;
-}
+  if (_cmfd != NULL) {
 
+    int num_FSRs = _FSR_registry->getNumFSRs();
+    std::vector< std::vector<int> > cell_fsrs(_cmfd->getNumCells());
 
-/**
- * @brief Sets the _FSRs_to_material_IDs vector
- * @param FSRs_to_material_IDs vector mapping FSR IDs to cells
- */
-void Geometry::setFSRsToMaterialIDs(std::vector<int> FSRs_to_material_IDs){
-  _FSRs_to_material_IDs = FSRs_to_material_IDs;
+    for (int r=0; r < num_FSRs; r++) {
+      Point* point = _FSR_registry->getFSRPoint(r);
+      LocalCoords coords(point->getX(), point->getY());
+      cell_fsrs.at(_cmfd->findCmfdCell(&coords)).push_back(r);
+    }
+
+    _cmfd->setCellFSRs(cell_fsrs);
+  }
 }
 
 
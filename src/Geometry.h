@@ -19,27 +19,12 @@
 #include <functional>
 #include "Cmfd.h"
 #ifndef CUDA
-  #include <unordered_map>
+  #include "FSRRegistry.h"
 #endif
 #endif
 
 
-/**
- * @struct fsr_data
- * @brief A fsr_data struct represents an FSR with a unique FSR ID
- *        and a characteristic point that lies within the FSR that
- *        can be used to recompute the hierarchical LocalCoords
- *        linked list.
- */
-struct fsr_data {
-
-  /** The FSR ID */
-  int _fsr_id;
-
-  /** Characteristic point in Universe 0 that lies in FSR */
-  Point* _point;
-
-};
+class FSRRegistry;
 
 void reset_auto_ids();
 
@@ -57,8 +42,6 @@ class Geometry {
 
 private:
 
-  omp_lock_t* _num_FSRs_lock;
-
   /** The boundary conditions at the top of the bounding box containing
    *  the Geometry. False is for vacuum and true is for reflective BCs. */
   boundaryType _top_bc;
@@ -75,19 +58,8 @@ private:
    *  the Geometry. False is for vacuum and true is for reflective BCs. */
   boundaryType _right_bc;
 
-  /** The total number of FSRs in the Geometry */
-  int _num_FSRs;
-
-  /** An map of FSR key hashes to unique fsr_data structs */
-#ifndef CUDA
-  std::unordered_map<std::size_t, fsr_data> _FSR_keys_map;
-#endif
-
-  /** An vector of FSR key hashes indexed by FSR ID */
-  std::vector<std::size_t> _FSRs_to_keys;
-
-  /** A vector of Material IDs indexed by FSR IDs */
-  std::vector<int> _FSRs_to_material_IDs;
+  /** The registry of FSR keys, IDs, characteristic points and Materials */
+  FSRRegistry* _FSR_registry;
 
   /** The maximum Track segment length in the Geometry */
   double _max_seg_length;
@@ -106,6 +78,9 @@ private:
 
   CellBasic* findFirstCell(LocalCoords* coords, double angle);
   CellBasic* findNextCell(LocalCoords* coords, double angle);
+#ifndef CUDA
+  void packFSRKey(LocalCoords* coords, fsr_key* key);
+#endif
 
 public:
 
@@ -144,20 +119,11 @@ public:
   int getFSRId(LocalCoords* coords);
   Point* getFSRPoint(int fsr_id);
   std::string getFSRKey(LocalCoords* coords);
-#ifndef CUDA
-  std::unordered_map<std::size_t, fsr_data> getFSRKeysMap();
-#endif
+  FSRRegistry* getFSRRegistry();
 
   /* Set parameters */
-  void setFSRsToMaterialIDs(std::vector<int> FSRs_to_material_IDs);
-  void setFSRsToKeys(std::vector<std::size_t> FSRs_to_keys);
-  void setNumFSRs(int num_fsrs);
   void setCmfd(Cmfd* cmfd);
 
-#ifndef CUDA
-  void setFSRKeysMap(std::unordered_map<std::size_t, fsr_data> FSR_keys_map);
-#endif
-
   /* Find methods */
   CellBasic* findCellContainingCoords(LocalCoords* coords);
   Material* findFSRMaterial(int fsr_id);
@@ -167,6 +133,7 @@ public:
   void subdivideCells();
   void initializeFlatSourceRegions();
   void segmentize(Track* track, FP_PRECISION max_optical_length);
+  void renumberFSRs(std::vector<int>& new_fsr_ids);
   void computeFissionability(Universe* univ=NULL);
 
   std::string toString();
@@ -1,4 +1,18 @@
 #include "Solver.h"
+#include <unistd.h>
+
+
+/** The names of the timed phases of each source iteration, which are used
+ *  for the Timer splits and the iteration history exports */
+static const char* phase_names[NUM_SOLVER_PHASES] = {
+  "Flux normalization",
+  "FSR source computation",
+  "Transport sweep",
+  "Source addition to scalar flux",
+  "k_eff computation",
+  "Cmfd k_eff solve",
+  "Cmfd boundary flux update"
+};
 /**
  * @brief Constructor initializes an empty Solver class with array pointers
  *        set to NULL.
@@ -31,9 +45,14 @@ Solver::Solver(Geometry* geometry, TrackGenerator* track_generator) {
 
   _tracks = NULL;
   _azim_weights = NULL;
+  _segment_offsets = NULL;
+  _segment_lengths = NULL;
+  _segment_fsr_ids = NULL;
+  _segment_material_indices = NULL;
+  _segment_cmfd_surfaces_fwd = NULL;
+  _segment_cmfd_surfaces_bwd = NULL;
   _polar_weights = NULL;
   _boundary_flux = NULL;
-  _boundary_leakage = NULL;
 
   _scalar_flux = NULL;
   _fission_sources = NULL;
@@ -43,7 +62,14 @@ Solver::Solver(Geometry* geometry, TrackGenerator* track_generator) {
   _source_residuals = NULL;
 
   _interpolate_exponential = true;
-  _exp_table = NULL;
+  _rational_exponential = false;
+  _exp_table_cache_level = 0;
+
+#ifdef SINGLE
+  _exp_table_precision = EXP_TABLE_SINGLE;
+#else
+  _exp_table_precision = EXP_TABLE_DOUBLE;
+#endif
 
   if (geometry != NULL){
     _cmfd = geometry->getCmfd();
@@ -106,9 +132,6 @@ Solver::~Solver() {
   if (_source_residuals != NULL)
     delete [] _source_residuals;
 
-  if (_exp_table != NULL)
-    delete [] _exp_table;
-
   if (_quad != NULL)
     delete _quad;
 }
@@ -196,6 +219,110 @@ FP_PRECISION Solver::getSourceConvergenceThreshold() {
 }
 
 
+/**
+ * @brief Returns the name of a timed phase of the source iterations.
+ * @param phase the source iteration phase
+ * @return the name of the phase
+ */
+const char* Solver::getPhaseName(solverPhase phase) {
+
+  if (phase < 0 || phase >= NUM_SOLVER_PHASES)
+    log_printf(ERROR, "Unable to return the name of phase %d since it is "
+               "not a source iteration phase", phase);
+
+  return phase_names[phase];
+}
+
+
+/**
+ * @brief Returns the total time spent in a phase of the source iterations.
+ * @param phase the source iteration phase
+ * @return the time spent in the phase (seconds)
+ */
+double Solver::getPhaseTime(solverPhase phase) {
+  return _timer->getSplit(getPhaseName(phase));
+}
+
+
+/**
+ * @brief Fills an array with the k_eff computed in each source iteration.
+ * @details This method may be called from Python to retrieve the history
+ *          as a NumPy array as follows:
+ *
+ * @code
+ *          keffs = solver.getKeffHistory(solver.getNumIterations())
+ * @endcode
+ *
+ * @param keffs an array to store the k_eff (implicitly passed in as a
+ *        NumPy array from Python)
+ * @param num_iterations the number of source iterations
+ */
+void Solver::getKeffHistory(double* keffs, int num_iterations) {
+
+  if (num_iterations != (int)_keff_history.size())
+    log_printf(ERROR, "Unable to return the k_eff history for %d iterations "
+               "since the Solver ran %d iterations", num_iterations,
+               (int)_keff_history.size());
+
+  for (int i=0; i < num_iterations; i++)
+    keffs[i] = _keff_history[i];
+}
+
+
+/**
+ * @brief Fills an array with the source residual in each source iteration.
+ * @details This method may be called from Python to retrieve the history
+ *          as a NumPy array as follows:
+ *
+ * @code
+ *          residuals = solver.getResidualHistory(solver.getNumIterations())
+ * @endcode
+ *
+ * @param residuals an array to store the residuals (implicitly passed in
+ *        as a NumPy array from Python)
+ * @param num_iterations the number of source iterations
+ */
+void Solver::getResidualHistory(double* residuals, int num_iterations) {
+
+  if (num_iterations != (int)_residual_history.size())
+    log_printf(ERROR, "Unable to return the residual history for %d "
+               "iterations since the Solver ran %d iterations",
+               num_iterations, (int)_residual_history.size());
+
+  for (int i=0; i < num_iterations; i++)
+    residuals[i] = _residual_history[i];
+}
+
+
+/**
+ * @brief Fills an array with the time spent in each phase of each source
+ *        iteration.
+ * @details The times are indexed by iteration and then by phase. This
+ *          method may be called from Python to retrieve the history as a
+ *          NumPy array as follows:
+ *
+ * @code
+ *          num_values = solver.getNumIterations() * openmoc.NUM_SOLVER_PHASES
+ *          times = solver.getPhaseTimeHistory(num_values)
+ *          times = times.reshape(-1, openmoc.NUM_SOLVER_PHASES)
+ * @endcode
+ *
+ * @param phase_times an array to store the times (implicitly passed in as
+ *        a NumPy array from Python)
+ * @param num_values the number of iterations times the number of phases
+ */
+void Solver::getPhaseTimeHistory(double* phase_times, int num_values) {
+
+  if (num_values != (int)_phase_time_history.size())
+    log_printf(ERROR, "Unable to return the phase time history with %d "
+               "values since the Solver has %d values", num_values,
+               (int)_phase_time_history.size());
+
+  for (int i=0; i < num_values; i++)
+    phase_times[i] = _phase_time_history[i];
+}
+
+
 /**
  * @brief Returns whether the Solver is using single floating point precision.
  * @return true if so, false otherwise
@@ -246,7 +373,42 @@ bool Solver::isUsingExponentialInterpolation() {
  * @return true if so, false otherwise
  */
 bool Solver::isUsingExponentialIntrinsic() {
-  return !_interpolate_exponential;
+  return !_interpolate_exponential && !_rational_exponential;
+}
+
+
+/**
+ * @brief Returns whether the Solver uses a rational approximation to
+ *        compute exponentials.
+ * @details The Solver::useExponentialRational() routine can be called to
+ *          use the branch-free rational approximation from rational_exp.h
+ *          instead of linear interpolation.
+ * @return true if so, false otherwise
+ */
+bool Solver::isUsingExponentialRational() {
+  return _rational_exponential;
+}
+
+
+/**
+ * @brief Returns the precision of the exponential linear interpolation table.
+ * @details The table is stored in the Solver's floating point precision by
+ *          default.
+ * @return EXP_TABLE_SINGLE or EXP_TABLE_DOUBLE
+ */
+expTablePrecision Solver::getExpTablePrecision() {
+  return _exp_table_precision;
+}
+
+
+/**
+ * @brief Returns the cache level which the exponential linear interpolation
+ *        table is sized to fit in.
+ * @return the cache level (1, 2 or 3), or 0 if the table is sized for the
+ *         source convergence threshold
+ */
+int Solver::getExpTableCacheLevel() {
+  return _exp_table_cache_level;
 }
 
 
@@ -316,6 +478,14 @@ void Solver::setTrackGenerator(TrackGenerator* track_generator) {
       counter++;
     }
   }
+
+  /* Retrieve the flat segment arrays streamed through in each sweep */
+  _segment_offsets = _track_generator->getTrackSegmentOffsets();
+  _segment_lengths = _track_generator->getSegmentLengths();
+  _segment_fsr_ids = _track_generator->getSegmentFSRIds();
+  _segment_material_indices = _track_generator->getSegmentMaterialIndices();
+  _segment_cmfd_surfaces_fwd = _track_generator->getSegmentCmfdSurfacesFwd();
+  _segment_cmfd_surfaces_bwd = _track_generator->getSegmentCmfdSurfacesBwd();
 }
 
 
@@ -370,6 +540,7 @@ void Solver::setSourceConvergenceThreshold(FP_PRECISION source_thresh) {
  */
 void Solver::useExponentialInterpolation() {
   _interpolate_exponential = true;
+  _rational_exponential = false;
 }
 
 
@@ -379,6 +550,122 @@ void Solver::useExponentialInterpolation() {
  */
 void Solver::useExponentialIntrinsic() {
   _interpolate_exponential = false;
+  _rational_exponential = false;
+}
+
+
+/**
+ * @brief Informs the Solver to use a branch-free rational approximation to
+ *        compute the exponential in the transport equation.
+ * @details The approximation has a maximum relative error below
+ *          \f$ 4.41 \times 10^{-8} \f$ for optical lengths in
+ *          \f$ [10^{-8}, 20] \f$ and is vectorized across energy groups by
+ *          the VectorizedSolver.
+ */
+void Solver::useExponentialRational() {
+  _interpolate_exponential = false;
+  _rational_exponential = true;
+}
+
+
+/**
+ * @brief Sets the precision of the exponential linear interpolation table.
+ * @details A single precision table halves the table's memory footprint for
+ *          double precision Solvers. A double precision table reduces the
+ *          roundoff in \f$ 1 - (a \tau + b) \f$ for small optical lengths
+ *          for single precision Solvers.
+ * @param precision EXP_TABLE_SINGLE or EXP_TABLE_DOUBLE
+ */
+void Solver::setExpTablePrecision(expTablePrecision precision) {
+  _exp_table_precision = precision;
+}
+
+
+/**
+ * @brief Sizes the exponential linear interpolation table to fit in a level
+ *        of the processor's data cache.
+ * @details By default the table spacing is chosen from the source convergence
+ *          threshold. For a cache level of 1, 2 or 3, the spacing is
+ *          coarsened if needed such that the table fills at most
+ *          EXP_TABLE_CACHE_FRACTION of that cache level, which trades
+ *          accuracy in the exponentials for fewer cache misses. A cache level
+ *          of 0 restores the default.
+ * @param cache_level the cache level (1, 2 or 3), or 0
+ */
+void Solver::setExpTableCacheLevel(int cache_level) {
+
+  if (cache_level < 0 || cache_level > 3)
+    log_printf(ERROR, "Unable to set the exponential table cache level to %d "
+               "since it is not 0, 1, 2 or 3", cache_level);
+
+  _exp_table_cache_level = cache_level;
+}
+
+
+/**
+ * @brief Computes the spacing and size of the exponential linear
+ *        interpolation table.
+ * @details The spacing is chosen such that the interpolation error is below
+ *          1% of the source convergence threshold. If a cache level is given,
+ *          the spacing is coarsened if needed such that the table fills at
+ *          most EXP_TABLE_CACHE_FRACTION of the data cache at that level.
+ *          The cache size is queried from the operating system and defaults
+ *          to 32 KB, 256 KB and 8 MB for levels 1, 2 and 3 if unavailable.
+ * @param entry_size the size in bytes of each slope and intercept
+ * @param cache_level the cache level to fit the table in, or 0
+ * @return the number of optical length values in the table
+ */
+int Solver::initializeExpTableSpacing(int entry_size, int cache_level) {
+
+  /* Find largest optical path length track segment */
+  FP_PRECISION tau = _track_generator->getMaxOpticalLength();
+
+  /* Expand tau slightly to accomodate track segments which have a
+   * length very nearly equal to the maximum value */
+  tau *= 1.01;
+
+  /* Set size of interpolation table */
+  int num_array_values = tau * sqrt(1./(8.*_source_convergence_thresh*1e-2));
+
+  if (cache_level > 0) {
+
+    long cache_size = 0;
+    long default_sizes[3] = {32768, 262144, 8388608};
+
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+    int names[3] = {_SC_LEVEL1_DCACHE_SIZE, _SC_LEVEL2_CACHE_SIZE,
+                    _SC_LEVEL3_CACHE_SIZE};
+    cache_size = sysconf(names[cache_level-1]);
+#endif
+
+    if (cache_size <= 0)
+      cache_size = default_sizes[cache_level-1];
+
+    int bytes_per_value = _two_times_num_polar * entry_size;
+    int max_array_values = EXP_TABLE_CACHE_FRACTION * cache_size /
+                           bytes_per_value;
+
+    if (max_array_values < num_array_values) {
+      FP_PRECISION spacing = tau / max_array_values;
+      log_printf(WARNING, "The exponential table is coarsened from %d to %d "
+                 "values to fit in the %ld KB L%d cache with an "
+                 "interpolation error of up to %1.2E", num_array_values,
+                 max_array_values, cache_size / 1024, cache_level,
+                 spacing * spacing / 8.);
+      num_array_values = max_array_values;
+    }
+  }
+
+  _exp_table_spacing = tau / num_array_values;
+  _inverse_exp_table_spacing = 1.0 / _exp_table_spacing;
+  _exp_table_size = _two_times_num_polar * num_array_values;
+  _exp_table_max_index = _exp_table_size - _two_times_num_polar - 1;
+
+  log_printf(INFO, "Exponential interpolation table with %d values requires "
+             "%.2f KB of memory", num_array_values,
+             _exp_table_size * entry_size / 1024.);
+
+  return num_array_values;
 }
 
 
@@ -414,9 +701,7 @@ void Solver::initializeCmfd(){
 void Solver::checkTrackSpacing() {
 
   int* FSR_segment_tallies = new int[_num_FSRs];
-  int num_segments;
-  segment* curr_segment;
-  segment* segments;
+  int tot_num_segments = _segment_offsets[_tot_num_tracks];
   Cell* cell;
 
   /* Set each tally to zero to begin with */
@@ -424,19 +709,10 @@ void Solver::checkTrackSpacing() {
   for (int r=0; r < _num_FSRs; r++)
     FSR_segment_tallies[r] = 0;
 
-  /* Iterate over all azimuthal angles, all tracks, and all Track segments
-   * and tally each segment in the corresponding FSR */
-  #pragma omp parallel for private (num_segments, curr_segment)
-  for (int i=0; i < _tot_num_tracks; i++) {
-
-    num_segments = _tracks[i]->getNumSegments();
-    segments = _tracks[i]->getSegments();
-
-    for (int s=0; s < num_segments; s++) {
-      curr_segment = &segments[s];
-      FSR_segment_tallies[curr_segment->_region_id]++;
-    }
-  }
+  /* Iterate over the flat array of all Track segments and tally each
+   * segment in the corresponding FSR */
+  for (int s=0; s < tot_num_segments; s++)
+    FSR_segment_tallies[_segment_fsr_ids[s]]++;
 
   /* Loop over all FSRs and if one FSR does not have tracks in it, print
    * error message to the screen and exit program */
@@ -493,6 +769,11 @@ FP_PRECISION Solver::convergeSource(int max_iterations) {
   /* Counter for the number of iterations to converge the source */
   _num_iterations = 0;
 
+  /* Clear the iteration history from a previous simulation run */
+  _keff_history.clear();
+  _residual_history.clear();
+  _phase_time_history.clear();
+
   /* An initial guess for the eigenvalue */
   _k_eff = 1.0;
 
@@ -527,19 +808,50 @@ FP_PRECISION Solver::convergeSource(int max_iterations) {
     log_printf(NORMAL, "Iteration %d: \tk_eff = %1.6f"
                "\tres = %1.3E", i, _k_eff, residual);
 
+    _phase_time_history.resize(_phase_time_history.size() +
+                               NUM_SOLVER_PHASES, 0.);
+
+    startPhaseTimer();
     normalizeFluxes();
+    stopPhaseTimer(PHASE_NORMALIZE_FLUXES);
+
+    startPhaseTimer();
+    _timer->startHardwareCounters();
     residual = computeFSRSources();
+    _timer->stopHardwareCounters(phase_names[PHASE_COMPUTE_SOURCES]);
+    stopPhaseTimer(PHASE_COMPUTE_SOURCES);
+
+    startPhaseTimer();
+    _timer->startHardwareCounters();
+    _timer->startAllocationCounter();
     transportSweep();
+    _timer->stopAllocationCounter("Heap allocations in transport sweeps");
+    _timer->stopHardwareCounters(phase_names[PHASE_TRANSPORT_SWEEP]);
+    stopPhaseTimer(PHASE_TRANSPORT_SWEEP);
+
+    startPhaseTimer();
     addSourceToScalarFlux();
+    stopPhaseTimer(PHASE_ADD_SOURCE);
 
     /* Solve CMFD diffusion problem and update MOC flux */
     if (_cmfd != NULL && _cmfd->isFluxUpdateOn()){
+      startPhaseTimer();
       _k_eff = _cmfd->computeKeff(i);
-      _cmfd->updateBoundaryFlux(_tracks, _boundary_flux, _tot_num_tracks);
+      stopPhaseTimer(PHASE_CMFD_KEFF);
+
+      startPhaseTimer();
+      _cmfd->updateBoundaryFlux(_tracks, _segment_offsets, _segment_fsr_ids,
+                                _boundary_flux, _tot_num_tracks);
+      stopPhaseTimer(PHASE_UPDATE_BOUNDARY_FLUX);
     }
-    else
+    else {
+      startPhaseTimer();
       computeKeff();
+      stopPhaseTimer(PHASE_COMPUTE_KEFF);
+    }
 
+    _keff_history.push_back(_k_eff);
+    _residual_history.push_back(residual);
     _num_iterations++;
 
     /* Check for convergence of the fission source distribution */
@@ -566,6 +878,73 @@ FP_PRECISION Solver::convergeSource(int max_iterations) {
  */
 void Solver::clearTimerSplits() {
   _timer->clearSplit("Total time to converge the source");
+
+  for (int p=0; p < NUM_SOLVER_PHASES; p++) {
+    _timer->clearSplit(phase_names[p]);
+    _timer->clearHardwareCounts(phase_names[p]);
+  }
+
+  _timer->clearSplit("Reproducible flux reductions");
+  _timer->clearCounter("Heap allocations in transport sweeps");
+}
+
+
+/**
+ * @brief Starts the Timer for a phase of a source iteration.
+ */
+void Solver::startPhaseTimer() {
+  _timer->startTimer();
+}
+
+
+/**
+ * @brief Stops the Timer for a phase of a source iteration and records the
+ *        time in the phase's Timer split and the iteration history.
+ * @param phase the source iteration phase
+ */
+void Solver::stopPhaseTimer(solverPhase phase) {
+
+  _timer->stopTimer();
+  _timer->recordSplit(phase_names[phase]);
+
+  _phase_time_history[_num_iterations * NUM_SOLVER_PHASES + phase] +=
+       _timer->getTime();
+}
+
+
+/**
+ * @brief Prints the hardware counts recorded for a timed code section.
+ * @details The cycles, instructions, cache misses and floating point
+ *          operations are normalized by a unit of work, ie, a segment
+ *          integration, and the instructions per cycle are printed. Nothing
+ *          is printed if no counts were recorded for the section.
+ * @param msg the message tag for the hardware counts
+ * @param unit the name of the unit of work
+ * @param num_units the number of units of work in the section
+ */
+void Solver::printHardwareCounts(const char* msg, const char* unit,
+                                 double num_units) {
+
+  std::string msg_string;
+  long cycles = _timer->getHardwareCount(msg, HW_CYCLES);
+
+  if (cycles == 0 || num_units == 0.)
+    return;
+
+  for (int e=0; e < NUM_HW_EVENTS; e++) {
+    long count = _timer->getHardwareCount(msg, (hardwareEvent)e);
+    msg_string = std::string(Timer::getHardwareEventName((hardwareEvent)e))
+               + " per " + unit;
+    msg_string[0] = toupper(msg_string[0]);
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%1.4E", msg_string.c_str(), count / num_units);
+  }
+
+  long instructions = _timer->getHardwareCount(msg, HW_INSTRUCTIONS);
+  msg_string = std::string("Instructions per cycle for ") + unit + "s";
+  msg_string.resize(53, '.');
+  log_printf(RESULT, "%s%1.4E", msg_string.c_str(),
+             double(instructions) / cycles);
 }
 
 
@@ -584,6 +963,19 @@ void Solver::printTimerReport() {
   msg_string.resize(53, '.');
   log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(), tot_time);
 
+  /* Time in each phase of the source iterations */
+  for (int p=0; p < NUM_SOLVER_PHASES; p++) {
+
+    double phase_time = _timer->getSplit(phase_names[p]);
+
+    if (phase_time == 0.)
+      continue;
+
+    msg_string = std::string("  ") + phase_names[p];
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(), phase_time);
+  }
+
   /* Time per unknown */
   double time_per_unknown = tot_time / (_num_FSRs * _num_groups);
   msg_string = "Solution time per unknown";
@@ -604,6 +996,42 @@ void Solver::printTimerReport() {
   msg_string.resize(53, '.');
   log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(), time_per_integration);
 
+  /* Hardware counts to judge whether the sweep is memory or compute bound */
+  if (_timer->hasHardwareCounters()) {
+    printHardwareCounts(phase_names[PHASE_TRANSPORT_SWEEP],
+                        "segment integration",
+                        double(num_integrations) * _num_iterations);
+    printHardwareCounts(phase_names[PHASE_COMPUTE_SOURCES], "FSR source",
+                        double(_num_FSRs) * _num_groups * _num_iterations);
+    printHardwareCounts("Ray tracing for track segmentation", "segment",
+                        num_segments);
+  }
+
+  /* Heap allocations made by all threads within the transport sweeps */
+  if (_timer->hasAllocationCounter()) {
+    long num_allocations =
+         _timer->getCounter("Heap allocations in transport sweeps");
+    msg_string = "Heap allocations per transport sweep";
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%1.4E", msg_string.c_str(),
+               double(num_allocations) / _num_iterations);
+  }
+
+  /* Overhead of reducing the segment contributions in a fixed order */
+  double reduction_time = _timer->getSplit("Reproducible flux reductions");
+
+  if (reduction_time > 0.) {
+    msg_string = "Reproducible reduction time per iteration";
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%1.4E sec", msg_string.c_str(),
+               reduction_time / _num_iterations);
+
+    msg_string = "Reproducible reduction share of solution time";
+    msg_string.resize(53, '.');
+    log_printf(RESULT, "%s%.2f %%", msg_string.c_str(),
+               100. * reduction_time / tot_time);
+  }
+
   set_separator_character('-');
   log_printf(SEPARATOR, "-");
 
@@ -635,3 +1063,91 @@ void Solver::printTimerReport() {
   log_printf(RESULT, "%s", msg.str().c_str());
   log_printf(SEPARATOR, "-");
 }
+
+
+/**
+ * @brief Writes the k_eff, source residual and phase times for each source
+ *        iteration to a file.
+ * @details The format is chosen from the file extension. A ".csv" file has
+ *          a header row and one row for each iteration with the iteration
+ *          number, k_eff, residual and the time in each phase. A ".json"
+ *          file also includes the problem size and the total time in each
+ *          phase. This may be called from Python as follows:
+ *
+ * @code
+ *          solver.exportIterationHistory('iterations.json')
+ * @endcode
+ *
+ * @param filename the name of the ".csv" or ".json" file to write
+ */
+void Solver::exportIterationHistory(const char* filename) {
+
+  std::string name = std::string(filename);
+  bool json = false;
+
+  if (name.size() > 5 && name.substr(name.size()-5) == ".json")
+    json = true;
+  else if (name.size() <= 4 || name.substr(name.size()-4) != ".csv")
+    log_printf(ERROR, "Unable to export the iteration history to %s since "
+               "it is not a .csv or .json file", filename);
+
+  FILE* out = fopen(filename, "w");
+
+  if (out == NULL)
+    log_printf(ERROR, "Unable to open %s to export the iteration history",
+               filename);
+
+  int num_iterations = _keff_history.size();
+
+  if (json) {
+    fprintf(out, "{\n");
+    fprintf(out, "  \"num_FSRs\": %d,\n", _num_FSRs);
+    fprintf(out, "  \"num_groups\": %d,\n", _num_groups);
+    fprintf(out, "  \"num_iterations\": %d,\n", num_iterations);
+    fprintf(out, "  \"total_time\": %.9e,\n",
+            _timer->getSplit("Total time to converge the source"));
+
+    fprintf(out, "  \"phases\": [");
+    for (int p=0; p < NUM_SOLVER_PHASES; p++)
+      fprintf(out, "%s\"%s\"", (p > 0) ? ", " : "", phase_names[p]);
+    fprintf(out, "],\n");
+
+    fprintf(out, "  \"phase_times\": {");
+    for (int p=0; p < NUM_SOLVER_PHASES; p++)
+      fprintf(out, "%s\"%s\": %.9e", (p > 0) ? ", " : "", phase_names[p],
+              _timer->getSplit(phase_names[p]));
+    fprintf(out, "},\n");
+
+    fprintf(out, "  \"iterations\": [\n");
+    for (int i=0; i < num_iterations; i++) {
+      fprintf(out, "    {\"iteration\": %d, \"k_eff\": %.15e, "
+              "\"residual\": %.9e, \"phase_times\": [", i,
+              _keff_history[i], _residual_history[i]);
+      for (int p=0; p < NUM_SOLVER_PHASES; p++)
+        fprintf(out, "%s%.9e", (p > 0) ? ", " : "",
+                _phase_time_history[i * NUM_SOLVER_PHASES + p]);
+      fprintf(out, "]}%s\n", (i < num_iterations - 1) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+  }
+
+  else {
+    fprintf(out, "iteration,k_eff,residual");
+    for (int p=0; p < NUM_SOLVER_PHASES; p++)
+      fprintf(out, ",%s", phase_names[p]);
+    fprintf(out, "\n");
+
+    for (int i=0; i < num_iterations; i++) {
+      fprintf(out, "%d,%.15e,%.9e", i, _keff_history[i],
+              _residual_history[i]);
+      for (int p=0; p < NUM_SOLVER_PHASES; p++)
+        fprintf(out, ",%.9e", _phase_time_history[i * NUM_SOLVER_PHASES + p]);
+      fprintf(out, "\n");
+    }
+  }
+
+  fclose(out);
+
+  log_printf(NORMAL, "Exported the history of %d source iterations to %s",
+             num_iterations, filename);
+}
@@ -40,11 +40,6 @@
                                                 + (j)*_polar_times_groups \
                                                 + (p)*_num_groups + (e)])
 
-/** Indexing macro for the leakage for each polar angle and energy group
- *  for both the forward and reverse direction for each track */
-#define _boundary_leakage(i,pe2) (_boundary_leakage[2*(i)*_polar_times_groups \
-                                                    +(pe2)])
-
 /** Indexing scheme for the total fission source (\f$ \nu\Sigma_f\Phi \f$)
  *  for each FSR and energy group */
 #define _fission_sources(r,e) (_fission_sources[(r)*_num_groups + (e)])
@@ -59,6 +54,57 @@
 /** The values of 1 divided by 4pi: \f$ \frac{1}{4\pi} \f$ */
 #define ONE_OVER_FOUR_PI 0.0795774715
 
+/** The fraction of a cache level which the exponential linear interpolation
+ *  table may fill when it is sized for cache residency */
+#define EXP_TABLE_CACHE_FRACTION 0.5
+
+
+/**
+ * @enum solverPhase
+ * @brief The phases of each source iteration which are timed by the Solver.
+ */
+enum solverPhase {
+
+  /** Normalizing the FSR scalar fluxes and Track boundary fluxes */
+  PHASE_NORMALIZE_FLUXES,
+
+  /** Computing the FSR sources and the source residual */
+  PHASE_COMPUTE_SOURCES,
+
+  /** Sweeping all Tracks to tally the FSR scalar fluxes */
+  PHASE_TRANSPORT_SWEEP,
+
+  /** Adding the source term to the FSR scalar fluxes */
+  PHASE_ADD_SOURCE,
+
+  /** Computing k_eff from the MOC fission and absorption rates */
+  PHASE_COMPUTE_KEFF,
+
+  /** Solving the Cmfd diffusion eigenvalue problem */
+  PHASE_CMFD_KEFF,
+
+  /** Updating the Track boundary fluxes from the Cmfd solution */
+  PHASE_UPDATE_BOUNDARY_FLUX,
+
+  /** The number of timed phases */
+  NUM_SOLVER_PHASES
+};
+
+
+/**
+ * @enum expTablePrecision
+ * @brief The precision in which the slopes and intercepts of the exponential
+ *        linear interpolation table are stored.
+ */
+enum expTablePrecision {
+
+  /** Single precision slopes and intercepts */
+  EXP_TABLE_SINGLE,
+
+  /** Double precision slopes and intercepts */
+  EXP_TABLE_DOUBLE
+};
+
 
 /**
  * @class Solver Solver.h "src/Solver.h"
@@ -126,6 +172,28 @@ protected:
   /** The weights for each azimuthal angle */
   FP_PRECISION* _azim_weights;
 
+  /** A pointer to the TrackGenerator's array of offsets for the first
+   *  segment of each Track into the flat segment arrays */
+  int* _segment_offsets;
+
+  /** A pointer to the TrackGenerator's flat array of segment lengths */
+  FP_PRECISION* _segment_lengths;
+
+  /** A pointer to the TrackGenerator's flat array of segment FSR IDs */
+  int* _segment_fsr_ids;
+
+  /** A pointer to the TrackGenerator's flat array of segment Material
+   *  indices */
+  int* _segment_material_indices;
+
+  /** A pointer to the TrackGenerator's flat array of forward segment
+   *  Cmfd Mesh surfaces */
+  int* _segment_cmfd_surfaces_fwd;
+
+  /** A pointer to the TrackGenerator's flat array of reverse segment
+   *  Cmfd Mesh surfaces */
+  int* _segment_cmfd_surfaces_bwd;
+
   /** The weights for each polar angle in the polar angle quadrature */
   FP_PRECISION* _polar_weights;
 
@@ -134,11 +202,6 @@ protected:
    *  a Track along both "forward" and "reverse" directions. */
   FP_PRECISION* _boundary_flux;
 
-  /** The angular leakages for each Track for all energy groups, polar angles,
-   *  and azimuthal angles. This array stores the weighted outgoing fluxes
-   *  for a Track along both "forward" and "reverse" directions. */
-  FP_PRECISION* _boundary_leakage;
-
   /** The scalar flux for each energy group in each FSR */
   FP_PRECISION* _scalar_flux;
 
@@ -167,6 +230,15 @@ protected:
   /** An array of k-effective at each iteration */
   std::vector<FP_PRECISION> _residual_vector;
 
+  /** The k_eff computed in each source iteration */
+  std::vector<double> _keff_history;
+
+  /** The source residual in each source iteration */
+  std::vector<double> _residual_history;
+
+  /** The time (seconds) spent in each phase of each source iteration */
+  std::vector<double> _phase_time_history;
+
   /** The total leakage across vacuum boundaries */
   FP_PRECISION _leakage;
 
@@ -183,8 +255,9 @@ protected:
    *  to comptue the exponential in the transport equation */
   bool _interpolate_exponential;
 
-  /** The exponential linear interpolation table */
-  FP_PRECISION* _exp_table;
+  /** A boolean indicating whether or not to use the rational approximation
+   *  to compute the exponential in the transport equation */
+  bool _rational_exponential;
 
   /** The size of the exponential linear interpolation table */
   int _exp_table_size;
@@ -198,6 +271,13 @@ protected:
   /** The inverse spacing for the exponential linear interpolation table */
   FP_PRECISION _inverse_exp_table_spacing;
 
+  /** The precision of the exponential linear interpolation table */
+  expTablePrecision _exp_table_precision;
+
+  /** The cache level which the exponential linear interpolation table is
+   *  sized to fit in, or 0 to size it for the convergence threshold */
+  int _exp_table_cache_level;
+
   /** A timer to record timing data for a simulation */
   Timer* _timer;
 
@@ -207,6 +287,8 @@ protected:
   int round_to_int(float x);
   int round_to_int(double x);
 
+  int initializeExpTableSpacing(int entry_size, int cache_level);
+
   /**
    * @brief Creates a polar quadrature object for the Solver.
    */
@@ -287,6 +369,10 @@ protected:
   virtual void transportSweep() =0;
 
   void clearTimerSplits();
+  void startPhaseTimer();
+  void stopPhaseTimer(solverPhase phase);
+  void printHardwareCounts(const char* msg, const char* unit,
+                           double num_units);
 
 
 public:
@@ -302,10 +388,19 @@ public:
   FP_PRECISION getKeff();
   FP_PRECISION getSourceConvergenceThreshold();
 
+  const char* getPhaseName(solverPhase phase);
+  double getPhaseTime(solverPhase phase);
+  void getKeffHistory(double* keffs, int num_iterations);
+  void getResidualHistory(double* residuals, int num_iterations);
+  void getPhaseTimeHistory(double* phase_times, int num_values);
+
   bool isUsingSinglePrecision();
   bool isUsingDoublePrecision();
   bool isUsingExponentialInterpolation();
   bool isUsingExponentialIntrinsic();
+  bool isUsingExponentialRational();
+  expTablePrecision getExpTablePrecision();
+  int getExpTableCacheLevel();
 
   /**
    * @brief Returns the scalar flux for a FSR and energy group.
@@ -337,6 +432,9 @@ public:
 
   void useExponentialInterpolation();
   void useExponentialIntrinsic();
+  void useExponentialRational();
+  void setExpTablePrecision(expTablePrecision precision);
+  void setExpTableCacheLevel(int cache_level);
 
   virtual FP_PRECISION convergeSource(int max_iterations);
 
@@ -358,7 +456,8 @@ public:
  */
   virtual void computeFSRFissionRates(double* fission_rates, int num_FSRs) =0;
 
-  void printTimerReport();
+  virtual void printTimerReport();
+  void exportIterationHistory(const char* filename);
 };
 
 
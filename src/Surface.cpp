@@ -164,6 +164,42 @@ bool Surface::isCoordOnSurface(LocalCoords* coord) {
 }
 
 
+/**
+ * @brief Returns a lower bound on the Surface's potential function within
+ *        an axis-aligned box in the xy-plane.
+ * @details The general Surface cannot bound its potential function and
+ *          returns -INFINITY. Subclasses return the minimum value of the
+ *          potential function within the box.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return a lower bound on the potential function within the box
+ */
+double Surface::getMinValue(double min_x, double max_x,
+                            double min_y, double max_y) {
+  return -std::numeric_limits<double>::infinity();
+}
+
+
+/**
+ * @brief Returns an upper bound on the Surface's potential function within
+ *        an axis-aligned box in the xy-plane.
+ * @details The general Surface cannot bound its potential function and
+ *          returns INFINITY. Subclasses return the maximum value of the
+ *          potential function within the box.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return an upper bound on the potential function within the box
+ */
+double Surface::getMaxValue(double min_x, double max_x,
+                            double min_y, double max_y) {
+  return std::numeric_limits<double>::infinity();
+}
+
+
 /**
  * @brief Prints a string representation of all of the Surface's objects to
  *        the console.
@@ -264,6 +300,48 @@ double Plane::getMaxZ(int halfspace){
 }
 
 
+/**
+ * @brief Returns the minimum value of the Plane's potential function within
+ *        an axis-aligned box in the xy-plane.
+ * @details The potential function is linear and its minimum is found at
+ *          one of the corners of the box.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return the minimum value of the potential function within the box
+ */
+double Plane::getMinValue(double min_x, double max_x,
+                          double min_y, double max_y) {
+
+  double x = (_A > 0.) ? min_x : max_x;
+  double y = (_B > 0.) ? min_y : max_y;
+
+  return _A * x + _B * y + _C;
+}
+
+
+/**
+ * @brief Returns the maximum value of the Plane's potential function within
+ *        an axis-aligned box in the xy-plane.
+ * @details The potential function is linear and its maximum is found at
+ *          one of the corners of the box.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return the maximum value of the potential function within the box
+ */
+double Plane::getMaxValue(double min_x, double max_x,
+                          double min_y, double max_y) {
+
+  double x = (_A > 0.) ? max_x : min_x;
+  double y = (_B > 0.) ? max_y : min_y;
+
+  return _A * x + _B * y + _C;
+}
+
+
 /**
  * @brief Returns the A coefficient multiplying x in the surface equation
  * @return the value for the A coefficient
@@ -726,6 +804,52 @@ double Circle::getMaxZ(int halfspace){
 }
 
 
+/**
+ * @brief Returns the minimum value of the Circle's potential function within
+ *        an axis-aligned box in the xy-plane.
+ * @details The minimum is found at the Point in the box which is closest to
+ *          the Circle's center.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return the minimum value of the potential function within the box
+ */
+double Circle::getMinValue(double min_x, double max_x,
+                           double min_y, double max_y) {
+
+  Point point;
+  point.setX(std::max(min_x, std::min(max_x, _center.getX())));
+  point.setY(std::max(min_y, std::min(max_y, _center.getY())));
+
+  return evaluate(&point);
+}
+
+
+/**
+ * @brief Returns the maximum value of the Circle's potential function within
+ *        an axis-aligned box in the xy-plane.
+ * @details The maximum is found at the corner of the box which is farthest
+ *          from the Circle's center.
+ * @param min_x the minimum x-coordinate of the box
+ * @param max_x the maximum x-coordinate of the box
+ * @param min_y the minimum y-coordinate of the box
+ * @param max_y the maximum y-coordinate of the box
+ * @return the maximum value of the potential function within the box
+ */
+double Circle::getMaxValue(double min_x, double max_x,
+                           double min_y, double max_y) {
+
+  Point point;
+  point.setX((_center.getX() - min_x > max_x - _center.getX()) ?
+             min_x : max_x);
+  point.setY((_center.getY() - min_y > max_y - _center.getY()) ?
+             min_y : max_y);
+
+  return evaluate(&point);
+}
+
+
 /**
  * @brief Finds the intersection Point with this circle from a given Point and
  *        trajectory defined by an angle (0, 1, or 2 points).
@@ -12,6 +12,7 @@
 #ifdef __cplusplus
 #include <limits>
 #include <cmath>    // std::abs
+#include <algorithm>
 #include "LocalCoords.h"
 #include "boundary_type.h"
 #endif
@@ -165,6 +166,10 @@ public:
 
   bool isPointOnSurface(Point* point) const;
   bool isCoordOnSurface(LocalCoords* coord);
+  virtual double getMinValue(double min_x, double max_x,
+                             double min_y, double max_y);
+  virtual double getMaxValue(double min_x, double max_x,
+                             double min_y, double max_y);
   double getMinDistance(Point* point, double angle, Point* intersection);
 
   /**
@@ -218,6 +223,11 @@ public:
   double getB();
   double getC();
 
+  double getMinValue(double min_x, double max_x,
+                     double min_y, double max_y);
+  double getMaxValue(double min_x, double max_x,
+                     double min_y, double max_y);
+
   double evaluate(const Point* point) const;
   int intersection(Point* point, double angle, Point* points);
 
@@ -346,6 +356,11 @@ public:
   double getMinZ(int halfspace);
   double getMaxZ(int halfspace);
 
+  double getMinValue(double min_x, double max_x,
+                     double min_y, double max_y);
+  double getMaxValue(double min_x, double max_x,
+                     double min_y, double max_y);
+
   double evaluate(const Point* point) const;
   int intersection(Point* point, double angle, Point* points);
 
@@ -0,0 +1,279 @@
+#include "ThreadPrivateSolver.h"
+
+
+/**
+ * @brief Constructor initializes array pointers for Tracks and Materials.
+ * @details The constructor retrieves the number of energy groups and FSRs
+ *          and azimuthal angles from the Geometry and TrackGenerator if
+ *          passed in as parameters by the user. The constructor initalizes
+ *          the number of OpenMP threads to a default of 1.
+ * @param geometry an optional pointer to the Geometry
+ * @param track_generator an optional pointer to the TrackGenerator
+ */
+ThreadPrivateSolver::ThreadPrivateSolver(Geometry* geometry,
+                                         TrackGenerator* track_generator)
+  : CPUSolver(geometry, track_generator) {
+
+  _thread_flux = NULL;
+  _thread_currents = NULL;
+}
+
+
+/**
+ * @brief Destructor calls CPUSolver subclass destructor to deletes arrays
+ *        for fluxes and sources.
+ */
+ThreadPrivateSolver::~ThreadPrivateSolver() {
+
+  if (_thread_flux != NULL) {
+    delete [] _thread_flux;
+    _thread_flux = NULL;
+  }
+
+  if (_thread_currents != NULL) {
+    delete [] _thread_currents;
+    _thread_currents = NULL;
+  }
+}
+
+
+/**
+ * @brief Allocates memory for Track boundary angular fluxes and leakages
+ *        and FSR scalar fluxes.
+ * @details Deletes memory for old flux arrays if they were allocated for a
+ *          previous simulation. This method allocates a separate copy of
+ *          the FSR scalar flux array for each thread.
+ */
+void ThreadPrivateSolver::initializeFluxArrays() {
+
+  CPUSolver::initializeFluxArrays();
+
+  /* Delete old thread private flux array if it exists */
+  if (_thread_flux != NULL)
+    delete [] _thread_flux;
+
+  long size = (long)_num_threads * _num_FSRs * _num_groups;
+
+  /* Allocate memory for the thread private FSR scalar flux array */
+  try{
+    _thread_flux = new FP_PRECISION[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the ThreadPrivateSolver's "
+               "thread private scalar fluxes. Backtrace:%s", e.what());
+  }
+
+  log_printf(INFO, "Thread private FSR scalar fluxes for %d threads require "
+             "%.2f MB of memory", _num_threads,
+             size * sizeof(FP_PRECISION) / 1.E6);
+}
+
+
+/**
+ * @brief Initializes Cmfd object for acceleration prior to source iteration.
+ * @details This method calls the CPUSolver parent class method and
+ *          allocates a separate copy of the Cmfd Mesh surface currents
+ *          array for each thread.
+ */
+void ThreadPrivateSolver::initializeCmfd() {
+
+  CPUSolver::initializeCmfd();
+
+  /* Delete old thread private surface currents array if it exists */
+  if (_thread_currents != NULL)
+    delete [] _thread_currents;
+
+  long size = (long)_num_threads * _num_mesh_cells * 8 *
+      _cmfd->getNumCmfdGroups();
+
+  /* Allocate memory for the thread private Cmfd Mesh surface currents */
+  try{
+    _thread_currents = new FP_PRECISION[size];
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the ThreadPrivateSolver's "
+               "thread private Cmfd Mesh surface currents. Backtrace:%s",
+               e.what());
+  }
+
+  log_printf(INFO, "Thread private Cmfd Mesh surface currents for %d "
+             "threads require %.2f MB of memory", _num_threads,
+             size * sizeof(FP_PRECISION) / 1.E6);
+}
+
+
+/**
+ * @brief Set the thread private FSR scalar flux for each FSR and energy
+ *        group to some value.
+ * @param value the value to assign to each thread private FSR scalar flux
+ */
+void ThreadPrivateSolver::flattenThreadFluxes(FP_PRECISION value) {
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int t=0; t < _num_threads; t++) {
+      for (int e=0; e < _num_groups; e++)
+        _thread_flux(t,r,e) = value;
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Set the thread private Cmfd Mesh surface currents for each Mesh
+ *        cell surface and energy group to zero.
+ */
+void ThreadPrivateSolver::zeroThreadCurrents() {
+
+  long size = (long)_num_threads * _num_mesh_cells * 8 *
+      _cmfd->getNumCmfdGroups();
+
+  #pragma omp parallel for schedule(guided)
+  for (long i=0; i < size; i++)
+    _thread_currents[i] = 0.0;
+
+  return;
+}
+
+
+/**
+ * @brief This method performs one transport sweep of all azimuthal angles,
+ *        Tracks, Track segments, polar angles and energy groups.
+ * @details The thread private FSR scalar fluxes and Cmfd Mesh surface
+ *          currents are zeroed before the CPUSolver's transport sweep and
+ *          reduced into the global arrays afterwards. The thread private
+ *          arrays are not used for reproducible flux updates.
+ */
+void ThreadPrivateSolver::transportSweep() {
+
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE) {
+    CPUSolver::transportSweep();
+    return;
+  }
+
+  /* Initialize the thread private tallies to zero */
+  flattenThreadFluxes(0.0);
+
+  if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
+    zeroThreadCurrents();
+
+  CPUSolver::transportSweep();
+
+  /* Reduce the thread private tallies */
+  reduceThreadScalarFluxes();
+
+  if (_cmfd != NULL && _cmfd->isFluxUpdateOn())
+    reduceThreadSurfaceCurrents();
+
+  return;
+}
+
+
+/**
+ * @brief Computes the contribution to the FSR scalar flux from a Track segment.
+ * @details This method integrates the angular flux for a Track segment across
+ *          energy groups and polar angles, and tallies it into the thread
+ *          private FSR scalar flux without any locks or atomics, and updates
+ *          the Track's angular flux.
+ * @param segment_id the index of the segment in the flat segment arrays
+ * @param azim_index a pointer to the azimuthal angle index for this segment
+ * @param track_flux a pointer to the Track's angular flux
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ * @param fwd
+ */
+void ThreadPrivateSolver::scalarFluxTally(int segment_id,
+                                          int azim_index,
+                                          FP_PRECISION* track_flux,
+                                          FP_PRECISION* fsr_flux,
+                                          bool fwd){
+
+  /* Reproducible flux updates store the contribution for each segment */
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE) {
+    CPUSolver::scalarFluxTally(segment_id, azim_index, track_flux,
+                               fsr_flux, fwd);
+    return;
+  }
+
+  int tid = omp_get_thread_num();
+  int fsr_id = _segment_fsr_ids[segment_id];
+  FP_PRECISION* stored_exponentials;
+
+  /* Use the stored exponentials or compute them for this segment */
+  if (_exponentials != NULL)
+    stored_exponentials = &_exponentials[(long)segment_id*_polar_times_groups];
+  else {
+    stored_exponentials = &_thread_segment_exponentials[tid *
+                                                        _polar_times_groups];
+    computeExponentials(segment_id, stored_exponentials);
+  }
+
+  /* Attenuate the angular flux and tally the thread private scalar flux */
+  _segment_kernel(_num_groups, _num_polar, track_flux,
+                  &_reduced_sources(fsr_id,0), stored_exponentials,
+                  &_polar_weights(azim_index,0), &_thread_flux(tid,fsr_id,0));
+
+  if (_cmfd != NULL && _cmfd->isFluxUpdateOn()){
+
+    int surface_id;
+
+    if (fwd)
+      surface_id = _segment_cmfd_surfaces_fwd[segment_id];
+    else
+      surface_id = _segment_cmfd_surfaces_bwd[segment_id];
+
+    if (surface_id != -1) {
+
+      /* Loop over energy groups */
+      for (int e=0; e < _num_groups; e++) {
+
+        /* Loop over polar angles */
+        for (int p=0; p < _num_polar; p++) {
+
+          /* Increment current (polar and azimuthal weighted flux, group) */
+          _thread_currents(tid,surface_id,e) +=
+              track_flux(p,e)*_polar_weights(azim_index,p)/2.0;
+        }
+      }
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Reduces the FSR scalar fluxes from private thread array to a
+ *        global array.
+ */
+void ThreadPrivateSolver::reduceThreadScalarFluxes() {
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int e=0; e < _num_groups; e++) {
+      for (int t=0; t < _num_threads; t++)
+        _scalar_flux(r,e) += _thread_flux(t,r,e);
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Reduces the Cmfd Mesh surface currents from private thread array
+ *        to a global array.
+ */
+void ThreadPrivateSolver::reduceThreadSurfaceCurrents() {
+
+  int size = _num_mesh_cells * 8 * _cmfd->getNumCmfdGroups();
+
+  #pragma omp parallel for schedule(guided)
+  for (int i=0; i < size; i++) {
+    for (int t=0; t < _num_threads; t++)
+      _surface_currents[i] += _thread_currents[(long)t*size+i];
+  }
+
+  return;
+}
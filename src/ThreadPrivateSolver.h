@@ -0,0 +1,67 @@
+/**
+ * @file ThreadPrivateSolver.h
+ * @brief The ThreadPrivateSolver class.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+
+#ifndef THREADPRIVATESOLVER_H_
+#define THREADPRIVATESOLVER_H_
+
+#ifdef __cplusplus
+#include "CPUSolver.h"
+#endif
+
+/** Indexing macro for the thread private FSR scalar fluxes */
+#define _thread_flux(t,r,e) (_thread_flux[(long)(t)*_num_FSRs*_num_groups \
+                                          + (long)(r)*_num_groups + (e)])
+
+/** Indexing macro for the thread private Cmfd Mesh surface currents */
+#define _thread_currents(t,r,e) (_thread_currents[(long)(t)*_num_mesh_cells*8 \
+                                 *_cmfd->getNumCmfdGroups() \
+                                 + (long)(r)*_cmfd->getNumCmfdGroups() \
+                                 + _cmfd->getCmfdGroup((e))])
+
+
+/**
+ * @class ThreadPrivateSolver ThreadPrivateSolver.h "src/ThreadPrivateSolver.h"
+ * @brief This is a subclass of the CPUSolver which uses thread private
+ *        arrays for the FSR scalar fluxes and Cmfd Mesh surface currents to
+ *        minimize OpenMP atomics.
+ * @details Since this class stores a separate copy of the FSR scalar
+ *          fluxes and Cmfd Mesh surface currents for each OMP thread, the
+ *          memory requirements are greater than for the CPUSolver. The
+ *          thread private copies are reduced in parallel at the end of each
+ *          transport sweep.
+ */
+class ThreadPrivateSolver : public CPUSolver {
+
+protected:
+
+  /** An array for the FSR scalar fluxes for each thread */
+  FP_PRECISION* _thread_flux;
+
+  /** An array for the Cmfd Mesh surface currents for each thread */
+  FP_PRECISION* _thread_currents;
+
+  void initializeFluxArrays();
+  void initializeCmfd();
+
+  void flattenThreadFluxes(FP_PRECISION value);
+  void zeroThreadCurrents();
+  void scalarFluxTally(int segment_id, int azim_index,
+                       FP_PRECISION* track_flux, FP_PRECISION* fsr_flux,
+                       bool fwd);
+  void reduceThreadScalarFluxes();
+  void reduceThreadSurfaceCurrents();
+  void transportSweep();
+
+public:
+  ThreadPrivateSolver(Geometry* geometry=NULL,
+                      TrackGenerator* track_generator=NULL);
+  virtual ~ThreadPrivateSolver();
+};
+
+
+#endif /* THREADPRIVATESOLVER_H_ */
@@ -1,19 +1,122 @@
 #include "Timer.h"
 
 
-std::map<std::string, double> Timer::_timer_splits;
-std::vector<double> Timer::_start_times;
+std::vector<TimerThreadState*> Timer::_thread_states;
+std::map<std::string, long> Timer::_timer_counters;
+long Timer::_allocations_at_start = 0;
+
+/** The timing state of the calling thread */
+static __thread TimerThreadState* thread_state = NULL;
+
+/** The names of each hardwareEvent used to tag the counters */
+static const char* hardware_event_names[NUM_HW_EVENTS] =
+  {"cycles", "instructions", "cache misses", "floating point operations"};
+
+#ifdef PAPI
+/** The preset PAPI events for each hardwareEvent in order of preference */
+static const int hardware_event_codes[NUM_HW_EVENTS][2] =
+  {{PAPI_TOT_CYC, PAPI_TOT_CYC},
+   {PAPI_TOT_INS, PAPI_TOT_INS},
+   {PAPI_L3_TCM, PAPI_L2_TCM},
+#ifdef SINGLE
+   {PAPI_SP_OPS, PAPI_FP_OPS}};
+#else
+   {PAPI_DP_OPS, PAPI_FP_OPS}};
+#endif
+#endif
+
+#ifdef COUNT_ALLOCATIONS
+/** The number of heap allocations made with operator new by all threads */
+static long num_heap_allocations = 0;
+
+
+/**
+ * @brief Replaces the global operator new to count the heap allocations.
+ * @details This is only compiled if OpenMOC is built with COUNT_ALLOCATIONS,
+ *          ie, in debug mode. The memory is allocated with malloc such that
+ *          it may be freed by any code in the process.
+ * @param size the number of bytes to allocate
+ * @return a pointer to the allocated memory
+ */
+void* operator new(size_t size) {
+
+  #pragma omp atomic
+  num_heap_allocations++;
+
+  void* ptr = malloc(size > 0 ? size : 1);
+
+  if (ptr == NULL)
+    throw std::bad_alloc();
+
+  return ptr;
+}
+
+
+/**
+ * @brief Replaces the global operator new[] to count the heap allocations.
+ * @param size the number of bytes to allocate
+ * @return a pointer to the allocated memory
+ */
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+
+/**
+ * @brief Replaces the global operator delete to match operator new.
+ * @param ptr a pointer to the memory to deallocate
+ */
+void operator delete(void* ptr) throw() {
+  free(ptr);
+}
+
+
+/**
+ * @brief Replaces the global operator delete[] to match operator new[].
+ * @param ptr a pointer to the memory to deallocate
+ */
+void operator delete[](void* ptr) throw() {
+  free(ptr);
+}
+#endif
+
+
+/**
+ * @brief Returns the timing state of the calling thread.
+ * @details The state is allocated and registered with the Timer the first
+ *          time a thread uses the Timer. The states are never deallocated
+ *          such that the splits recorded by threads which have exited are
+ *          still reported.
+ * @return a pointer to the calling thread's timing state
+ */
+TimerThreadState* Timer::getThreadState() {
+
+  if (thread_state == NULL) {
+
+    thread_state = new TimerThreadState();
+    thread_state->_elapsed_time = 0.;
+#ifdef PAPI
+    thread_state->_event_set_created = false;
+#endif
+
+    #pragma omp critical (timer_thread_states)
+    _thread_states.push_back(thread_state);
+  }
+
+  return thread_state;
+}
 
 
 /**
  * @brief Starts the Timer.
- * @details This method is similar to starting a stopwatch.
+ * @details This method is similar to starting a stopwatch. Timers are
+ *          nested such that each call must be matched by a call to
+ *          stopTimer() from the same thread.
  */
 void Timer::startTimer() {
 
-  double start_time = omp_get_wtime();
-  _start_times.push_back(start_time);
-  _running = true;
+  TimerThreadState* state = getThreadState();
+  state->_start_times.push_back(getWallTime());
 
   return;
 }
@@ -21,21 +124,20 @@ void Timer::startTimer() {
 
 /**
  * @brief Stops the Timer.
- * @details This method is similar to stopping a stopwatch.
+ * @details This method is similar to stopping a stopwatch. The innermost
+ *          Timer started by the calling thread is stopped.
  */
 void Timer::stopTimer() {
 
-  if (_running) {
-
-    double end_time = omp_get_wtime();
-    double start_time = _start_times.back();
+  TimerThreadState* state = getThreadState();
 
-    _elapsed_time = end_time - start_time;
+  if (!state->_start_times.empty()) {
 
-    if (_start_times.empty())
-      _running = false;
+    double end_time = getWallTime();
+    double start_time = state->_start_times.back();
 
-    _start_times.pop_back();
+    state->_elapsed_time = end_time - start_time;
+    state->_start_times.pop_back();
   }
 
   return;
@@ -46,87 +148,141 @@ void Timer::stopTimer() {
  * @brief Records a message corresponding to a time for the current split.
  * @details When this method is called it assumes that the Timer has been
  *          stopped and has the current time for the process corresponding
- *          to the message.
+ *          to the message. The time is added to the calling thread's split.
  * @param msg a msg corresponding to this time split
  */
 void Timer::recordSplit(const char* msg) {
 
-  double time = getTime();
-  std::string msg_string = std::string(msg);
-
-  if (_timer_splits.find(msg_string) != _timer_splits.end())
-    _timer_splits.at(msg_string) += time;
-  else
-    _timer_splits.insert(std::pair<std::string, double>(msg_string, time));
+  TimerThreadState* state = getThreadState();
+  state->_timer_splits[std::string(msg)] += state->_elapsed_time;
 }
 
 
 /**
- * @brief Returns the time elapsed from startTimer() to stopTimer().
+ * @brief Returns the time elapsed from startTimer() to stopTimer() for
+ *        the calling thread.
  * @return the elapsed time in seconds
  */
 double Timer::getTime() {
-  return _elapsed_time;
+  return getThreadState()->_elapsed_time;
 }
 
 
 /**
  * @brief Returns the time associated with a particular split.
- * @details If the split does not exist, returns 0.
+ * @details The times recorded by each thread are summed. If the split does
+ *          not exist, returns 0. This method should not be called while
+ *          other threads are recording splits.
  * @param msg the message tag for the split
  * @return the time recorded for the split (seconds)
  */
 double Timer::getSplit(const char* msg) {
 
   std::string msg_string = std::string(msg);
+  std::map<std::string, double>::iterator iter;
+  double split = 0.;
+
+  #pragma omp critical (timer_thread_states)
+  {
+    for (size_t t=0; t < _thread_states.size(); t++) {
+      iter = _thread_states[t]->_timer_splits.find(msg_string);
+      if (iter != _thread_states[t]->_timer_splits.end())
+        split += iter->second;
+    }
+  }
 
-  if (_timer_splits.find(msg_string) == _timer_splits.end())
-    return 0.0;
-  else
-    return _timer_splits.at(msg_string);
+  return split;
+}
+
+
+/**
+ * @brief Returns the maximum time recorded by any one thread for a
+ *        particular split.
+ * @details This is the wall clock time for a split recorded by each thread
+ *          in a parallel region. If the split does not exist, returns 0.
+ * @param msg the message tag for the split
+ * @return the maximum time recorded by a thread for the split (seconds)
+ */
+double Timer::getMaxSplit(const char* msg) {
+
+  std::string msg_string = std::string(msg);
+  std::map<std::string, double>::iterator iter;
+  double split = 0.;
+
+  #pragma omp critical (timer_thread_states)
+  {
+    for (size_t t=0; t < _thread_states.size(); t++) {
+      iter = _thread_states[t]->_timer_splits.find(msg_string);
+      if (iter != _thread_states[t]->_timer_splits.end())
+        split = std::max(split, iter->second);
+    }
+  }
+
+  return split;
 }
 
 
 /**
  * @brief Prints the times and messages for each split to the console.
- * @details This method will loop through all of the Timer's splits and print a
- *          formatted message string (80 characters in length) to the console
- *          with the message and the time corresponding to that message.
+ * @details This method will merge the splits recorded by each thread and
+ *          print a formatted message string (80 characters in length) to the
+ *          console with the message and the total time corresponding to that
+ *          message. The maximum time of any one thread is also printed for
+ *          splits recorded by more than one thread.
  */
 void Timer::printSplits() {
 
-  std::string curr_msg;
-  double curr_split;
+  std::map<std::string, double> splits;
+  std::map<std::string, double> max_splits;
+  std::map<std::string, int> num_threads;
   std::map<std::string, double>::iterator iter;
 
-  for (iter = _timer_splits.begin(); iter != _timer_splits.end(); ++iter) {
-
-    std::stringstream formatted_msg;
+  #pragma omp critical (timer_thread_states)
+  {
+    for (size_t t=0; t < _thread_states.size(); t++) {
+      std::map<std::string, double>& thread_splits =
+           _thread_states[t]->_timer_splits;
+
+      for (iter = thread_splits.begin(); iter != thread_splits.end(); ++iter) {
+        splits[iter->first] += iter->second;
+        max_splits[iter->first] = std::max(max_splits[iter->first],
+                                           iter->second);
+        num_threads[iter->first]++;
+      }
+    }
+  }
 
-    curr_msg = (*iter).first;
-    curr_split = (*iter).second;
+  for (iter = splits.begin(); iter != splits.end(); ++iter) {
 
+    std::string curr_msg = iter->first;
     curr_msg.resize(53, '.');
-    formatted_msg << curr_msg;
-
-    log_printf(RESULT, "%s%1.4E sec", formatted_msg.str().c_str(), curr_split);
+    log_printf(RESULT, "%s%1.4E sec", curr_msg.c_str(), iter->second);
+
+    if (num_threads[iter->first] > 1) {
+      curr_msg = "  Maximum over " + std::to_string(num_threads[iter->first])
+               + " threads";
+      curr_msg.resize(53, '.');
+      log_printf(RESULT, "%s%1.4E sec", curr_msg.c_str(),
+                 max_splits[iter->first]);
+    }
   }
 }
 
 
 /**
  * @brief Clears the time split for this message and deletes the message's
- *        entry in the Timer's splits log.
+ *        entry in each thread's splits log.
  * @param msg the message tag for the split
  */
 void Timer::clearSplit(const char* msg) {
 
   std::string msg_string = std::string(msg);
 
-  if (_timer_splits.find(msg_string) == _timer_splits.end())
-    return;
-  else
-    _timer_splits.erase(msg_string);
+  #pragma omp critical (timer_thread_states)
+  {
+    for (size_t t=0; t < _thread_states.size(); t++)
+      _thread_states[t]->_timer_splits.erase(msg_string);
+  }
 }
 
 
@@ -134,5 +290,296 @@ void Timer::clearSplit(const char* msg) {
  * @brief Clears all times split messages from the Timer.
  */
 void Timer::clearSplits() {
-  _timer_splits.clear();
+
+  #pragma omp critical (timer_thread_states)
+  {
+    for (size_t t=0; t < _thread_states.size(); t++)
+      _thread_states[t]->_timer_splits.clear();
+  }
+}
+
+
+/**
+ * @brief Increments the count of events (ie, hardware events) recorded
+ *        for a message.
+ * @details This method is thread safe and may be called from within an
+ *          OpenMP parallel region.
+ * @param msg the message tag for the counter
+ * @param count the number of events to add to the counter
+ */
+void Timer::incrementCounter(const char* msg, long count) {
+
+  std::string msg_string = std::string(msg);
+
+  #pragma omp critical (timer_counters)
+  {
+    if (_timer_counters.find(msg_string) != _timer_counters.end())
+      _timer_counters.at(msg_string) += count;
+    else
+      _timer_counters.insert(std::pair<std::string, long>(msg_string, count));
+  }
+}
+
+
+/**
+ * @brief Returns the count of events recorded for a message.
+ * @details If the counter does not exist, returns 0. This method is
+ *          thread safe.
+ * @param msg the message tag for the counter
+ * @return the number of events recorded for the counter
+ */
+long Timer::getCounter(const char* msg) {
+
+  std::string msg_string = std::string(msg);
+  long count = 0;
+
+  #pragma omp critical (timer_counters)
+  {
+    if (_timer_counters.find(msg_string) != _timer_counters.end())
+      count = _timer_counters.at(msg_string);
+  }
+
+  return count;
+}
+
+
+/**
+ * @brief Clears the count of events for this message and deletes the
+ *        message's entry in the Timer's counters log.
+ * @param msg the message tag for the counter
+ */
+void Timer::clearCounter(const char* msg) {
+
+  std::string msg_string = std::string(msg);
+
+  #pragma omp critical (timer_counters)
+  {
+    if (_timer_counters.find(msg_string) != _timer_counters.end())
+      _timer_counters.erase(msg_string);
+  }
+}
+
+
+/**
+ * @brief Initializes the PAPI library the first time the hardware counters
+ *        are used.
+ * @details A warning is printed if OpenMOC was built with PAPI but the
+ *          library cannot be initialized, ie, if the kernel does not permit
+ *          access to the hardware counters.
+ * @return whether the hardware counters are available
+ */
+bool Timer::initializeHardwareCounters() {
+
+#ifdef PAPI
+  static bool initialized = false;
+  static bool available = false;
+
+  if (initialized)
+    return available;
+
+  initialized = true;
+
+  if (PAPI_library_init(PAPI_VER_CURRENT) != PAPI_VER_CURRENT)
+    log_printf(WARNING, "Unable to initialize the PAPI library so hardware "
+               "counters will not be reported");
+  else if (PAPI_thread_init((unsigned long (*)(void))pthread_self)
+           != PAPI_OK)
+    log_printf(WARNING, "Unable to initialize PAPI for threads so hardware "
+               "counters will not be reported");
+  else
+    available = true;
+
+  return available;
+#else
+  return false;
+#endif
+}
+
+
+/**
+ * @brief Returns whether OpenMOC was built with PAPI and the hardware
+ *        counters are available.
+ * @return whether hardware counts are recorded
+ */
+bool Timer::hasHardwareCounters() {
+  return initializeHardwareCounters();
+}
+
+
+/**
+ * @brief Returns the name of a hardware event.
+ * @param event the hardware event
+ * @return the name of the event
+ */
+const char* Timer::getHardwareEventName(hardwareEvent event) {
+  return hardware_event_names[event];
+}
+
+
+/**
+ * @brief Starts the hardware counters for the calling thread.
+ * @details The thread's PAPI event set is created the first time the thread
+ *          uses the hardware counters. Events which are not available on
+ *          this processor are left out of the event set.
+ */
+void Timer::startThreadHardwareCounters() {
+
+#ifdef PAPI
+  TimerThreadState* state = getThreadState();
+
+  if (!state->_event_set_created) {
+
+    int num_events = 0;
+    state->_event_set_created = true;
+    state->_event_set = PAPI_NULL;
+    PAPI_register_thread();
+    PAPI_create_eventset(&state->_event_set);
+
+    for (int e=0; e < NUM_HW_EVENTS; e++) {
+      state->_event_indices[e] = -1;
+
+      for (int c=0; c < 2; c++) {
+        if (PAPI_add_event(state->_event_set, hardware_event_codes[e][c])
+            == PAPI_OK) {
+          state->_event_indices[e] = num_events++;
+          break;
+        }
+      }
+    }
+  }
+
+  PAPI_start(state->_event_set);
+#endif
+}
+
+
+/**
+ * @brief Stops the hardware counters for the calling thread and adds the
+ *        counts to the Timer's counters for a message.
+ * @param msg the message tag for the hardware counts
+ */
+void Timer::stopThreadHardwareCounters(const char* msg) {
+
+#ifdef PAPI
+  TimerThreadState* state = getThreadState();
+  long long counts[NUM_HW_EVENTS];
+
+  if (PAPI_stop(state->_event_set, counts) != PAPI_OK)
+    return;
+
+  for (int e=0; e < NUM_HW_EVENTS; e++) {
+    if (state->_event_indices[e] >= 0) {
+      std::string counter = std::string(msg) + " " + hardware_event_names[e];
+      incrementCounter(counter.c_str(), counts[state->_event_indices[e]]);
+    }
+  }
+#endif
+}
+
+
+/**
+ * @brief Starts the hardware counters on each OpenMP thread.
+ * @details This method must be called outside of parallel regions and
+ *          relies upon the OpenMP runtime reusing the same threads for the
+ *          parallel regions until stopHardwareCounters() is called. It does
+ *          nothing unless OpenMOC was built with PAPI.
+ */
+void Timer::startHardwareCounters() {
+
+  if (!initializeHardwareCounters())
+    return;
+
+  #pragma omp parallel
+  startThreadHardwareCounters();
+}
+
+
+/**
+ * @brief Stops the hardware counters on each OpenMP thread and adds the
+ *        counts summed over threads to the Timer's counters for a message.
+ * @details The counts are retrieved with getHardwareCount(). This method
+ *          must be called outside of parallel regions.
+ * @param msg the message tag for the hardware counts
+ */
+void Timer::stopHardwareCounters(const char* msg) {
+
+  if (!initializeHardwareCounters())
+    return;
+
+  #pragma omp parallel
+  stopThreadHardwareCounters(msg);
+}
+
+
+/**
+ * @brief Returns the count of a hardware event recorded for a message.
+ * @details If no counts were recorded, returns 0.
+ * @param msg the message tag for the hardware counts
+ * @param event the hardware event
+ * @return the number of events summed over threads
+ */
+long Timer::getHardwareCount(const char* msg, hardwareEvent event) {
+  std::string counter = std::string(msg) + " " + hardware_event_names[event];
+  return getCounter(counter.c_str());
+}
+
+
+/**
+ * @brief Clears the counts of each hardware event recorded for a message.
+ * @param msg the message tag for the hardware counts
+ */
+void Timer::clearHardwareCounts(const char* msg) {
+
+  for (int e=0; e < NUM_HW_EVENTS; e++) {
+    std::string counter = std::string(msg) + " " + hardware_event_names[e];
+    clearCounter(counter.c_str());
+  }
+}
+
+
+/**
+ * @brief Returns whether OpenMOC was built with COUNT_ALLOCATIONS such that
+ *        the heap allocations made with operator new are counted.
+ * @return whether heap allocations are counted
+ */
+bool Timer::hasAllocationCounter() {
+#ifdef COUNT_ALLOCATIONS
+  return true;
+#else
+  return false;
+#endif
+}
+
+
+/**
+ * @brief Starts counting the heap allocations made by all threads.
+ * @details This method must be called outside of parallel regions and the
+ *          allocation counter may not be nested. It does nothing unless
+ *          OpenMOC was built with COUNT_ALLOCATIONS.
+ */
+void Timer::startAllocationCounter() {
+#ifdef COUNT_ALLOCATIONS
+  #pragma omp atomic read
+  _allocations_at_start = num_heap_allocations;
+#endif
+}
+
+
+/**
+ * @brief Stops counting the heap allocations and adds the number made by
+ *        all threads since startAllocationCounter() to the Timer's counter
+ *        for a message.
+ * @details The count is retrieved with getCounter(). This method must be
+ *          called outside of parallel regions.
+ * @param msg the message tag for the counter
+ */
+void Timer::stopAllocationCounter(const char* msg) {
+#ifdef COUNT_ALLOCATIONS
+  long num_allocations;
+
+  #pragma omp atomic read
+  num_allocations = num_heap_allocations;
+
+  incrementCounter(msg, num_allocations - _allocations_at_start);
+#endif
 }
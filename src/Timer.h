@@ -1,6 +1,6 @@
 /**
  * @file Timer.h
- * @brief The Timer class.
+ * @brief The Timer and ScopedTimer classes.
  * @date January 2, 2012
  * @author  William Boyd, MIT, Course 22 (wboyd@mit.edu)
  */
@@ -10,38 +10,111 @@
 
 #ifdef __cplusplus
 #include <time.h>
+#include <stdlib.h>
 #include <omp.h>
 #include <iostream>
 #include <sstream>
 #include <iomanip>
 #include <utility>
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <string>
+#include <new>
 #include "log.h"
+#ifdef PAPI
+#include <pthread.h>
+#include <papi.h>
+#endif
+#endif
+
+
+/**
+ * @enum hardwareEvent
+ * @brief The hardware events counted around timed sections of code when
+ *        OpenMOC is built with PAPI.
+ */
+enum hardwareEvent {
+
+  /** The number of processor cycles */
+  HW_CYCLES,
+
+  /** The number of instructions completed */
+  HW_INSTRUCTIONS,
+
+  /** The number of last level cache misses */
+  HW_CACHE_MISSES,
+
+  /** The number of floating point operations */
+  HW_FLOPS,
+
+  /** The number of hardware events */
+  NUM_HW_EVENTS
+};
+
+
+#ifndef SWIG
+/**
+ * @struct TimerThreadState Timer.h "src/Timer.h"
+ * @brief The start times, elapsed time and splits recorded by one thread.
+ * @details Each thread which uses the Timer owns one of these such that
+ *          timers may be started, stopped and recorded within OpenMP
+ *          parallel regions without synchronization.
+ */
+struct TimerThreadState {
+
+  /** A vector of the start times at each nested level timed by the thread */
+  std::vector<double> _start_times;
+
+  /** The time elapsed (seconds) for the thread's current split */
+  double _elapsed_time;
+
+  /** A map of the times and messages for each split recorded by the
+   *  thread */
+  std::map<std::string, double> _timer_splits;
+
+#ifdef PAPI
+  /** Whether the thread's PAPI event set has been created */
+  bool _event_set_created;
+
+  /** The PAPI event set for the thread's hardware counters */
+  int _event_set;
+
+  /** The index of each hardwareEvent in the event set (-1 if the event is
+   *  not available on this processor) */
+  int _event_indices[NUM_HW_EVENTS];
+#endif
+};
 #endif
 
 
 /**
  * @class Timer Timer.h "src/Timer.cpp"
  * @brief The Timer class is for timing and profiling regions of code.
+ * @details Timers may be nested and may be started and stopped from within
+ *          OpenMP parallel regions. The start times and splits are kept
+ *          separately for each thread and are merged when the splits are
+ *          queried or printed, which should be done outside of parallel
+ *          regions. Times are measured with a monotonic clock.
  */
 class Timer {
 
 private:
 
-  /** A vector of floating point start times at each inclusive level
-   *  at which we are timing */
-  static std::vector<double> _start_times;
+  /** The timing state of each thread that has used the Timer */
+  static std::vector<TimerThreadState*> _thread_states;
 
-  /** The time elapsed (seconds) for the current split */
-  float _elapsed_time;
+  /** A map of the event counts and messages for each counter */
+  static std::map<std::string, long> _timer_counters;
 
-  /** Whether or not the Timer is running for the current split */
-  bool _running;
+  /** The number of heap allocations made when the allocation counter was
+   *  last started */
+  static long _allocations_at_start;
 
-  /** A vector of the times and messages for each split */
-  static std::map<std::string, double> _timer_splits;
+  static TimerThreadState* getThreadState();
+  static bool initializeHardwareCounters();
+  void startThreadHardwareCounters();
+  void stopThreadHardwareCounters(const char* msg);
 
   /**
    * @brief Assignment operator for static referencing of the Timer.
@@ -58,12 +131,10 @@ private:
 
 public:
   /**
-   * @brief Constructor sets the current split elapsed time to zero.
+   * @brief Constructor for a Timer.
+   * @details All Timers share the per-thread timing state.
    */
-  Timer() {
-    _running = false;
-    _elapsed_time = 0;
-  }
+  Timer() { }
 
   /**
    * @brief Destructor
@@ -79,14 +150,80 @@ public:
     return &instance;
   }
 
+  /**
+   * @brief Returns the current time of a high resolution monotonic clock.
+   * @return the time in seconds from an arbitrary starting point
+   */
+  static double getWallTime() {
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + 1.E-9 * time.tv_nsec;
+  }
+
   void startTimer();
   void stopTimer();
   void recordSplit(const char* msg);
   double getTime();
   double getSplit(const char* msg);
+  double getMaxSplit(const char* msg);
   void printSplits();
   void clearSplit(const char* msg);
   void clearSplits();
+  void incrementCounter(const char* msg, long count=1);
+  long getCounter(const char* msg);
+  void clearCounter(const char* msg);
+
+  static bool hasHardwareCounters();
+  static const char* getHardwareEventName(hardwareEvent event);
+  void startHardwareCounters();
+  void stopHardwareCounters(const char* msg);
+  long getHardwareCount(const char* msg, hardwareEvent event);
+  void clearHardwareCounts(const char* msg);
+
+  static bool hasAllocationCounter();
+  void startAllocationCounter();
+  void stopAllocationCounter(const char* msg);
+};
+
+
+#ifndef SWIG
+/**
+ * @class ScopedTimer Timer.h "src/Timer.h"
+ * @brief Times the enclosing scope and records the time in a Timer split.
+ * @details The Timer is started when the ScopedTimer is constructed and is
+ *          stopped and recorded under the message when it is destroyed. It
+ *          may be used within an OpenMP parallel region, in which case the
+ *          times of the threads are summed in the split.
+ */
+class ScopedTimer {
+
+private:
+
+  /** The message tag for the split */
+  const char* _msg;
+
+  ScopedTimer(const ScopedTimer &);
+  ScopedTimer &operator=(const ScopedTimer &);
+
+public:
+
+  /**
+   * @brief Constructor starts the Timer.
+   * @param msg the message tag for the split (must outlive the ScopedTimer)
+   */
+  explicit ScopedTimer(const char* msg) : _msg(msg) {
+    Timer::Get()->startTimer();
+  }
+
+  /**
+   * @brief Destructor stops the Timer and records the split.
+   */
+  ~ScopedTimer() {
+    Timer* timer = Timer::Get();
+    timer->stopTimer();
+    timer->recordSplit(_msg);
+  }
 };
+#endif
 
 #endif /* TIMER_H_ */
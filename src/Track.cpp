@@ -369,10 +369,10 @@ bool Track::contains(Point* point) {
 
 
 /**
- * @brief Deletes each of this Track's segments.
+ * @brief Deletes each of this Track's segments and releases their memory.
  */
 void Track::clearSegments() {
-  _segments.clear();
+  std::vector<segment>().swap(_segments);
 }
 
 
@@ -18,10 +18,19 @@ TrackGenerator::TrackGenerator(Geometry* geometry, const int num_azim,
   _tot_num_tracks = 0;
   _tot_num_segments = 0;
   _num_segments = NULL;
+  _track_segment_offsets = NULL;
+  _segment_lengths = NULL;
+  _segment_fsr_ids = NULL;
+  _segment_material_indices = NULL;
+  _segment_cmfd_surfaces_fwd = NULL;
+  _segment_cmfd_surfaces_bwd = NULL;
+  _segment_materials = NULL;
+  _num_segment_materials = 0;
   _contains_tracks = false;
   _use_input_file = false;
   _tracks_filename = "";
   _max_optical_length = 10;
+  _FSR_numbering = FSR_NUMBERING_CSG_PATH;
 }
 
 
@@ -43,6 +52,8 @@ TrackGenerator::~TrackGenerator() {
 
     delete [] _tracks;
   }
+
+  clearSegmentArrays();
 }
 
 
@@ -64,6 +75,27 @@ void TrackGenerator::setNumThreads(int num_threads) {
 }
 
 
+/**
+ * @brief Sets the order in which the FSRs are numbered after ray tracing.
+ * @details FSR IDs are assigned in order of discovery while the Tracks are
+ *          segmentized in parallel, which depends on the scheduling of the
+ *          threads. The FSRs are then renumbered in the chosen order such
+ *          that tallies and plots may be compared across runs:
+ *
+ * @code
+ *          track_generator.setFSRNumbering(openmoc.FSR_NUMBERING_TRACK)
+ * @endcode
+ *
+ *          The FSRs are numbered by their path through the CSG hierarchy by
+ *          default. Track files are only reused for the same FSR numbering.
+ * @param numbering the FSR numbering (FSR_NUMBERING_DISCOVERY,
+ *        FSR_NUMBERING_CSG_PATH or FSR_NUMBERING_TRACK)
+ */
+void TrackGenerator::setFSRNumbering(fsrNumbering numbering) {
+  _FSR_numbering = numbering;
+}
+
+
 /**
  * @brief Returns the number of shared memory OpenMP threads in use.
  * @return the number of threads
@@ -73,6 +105,15 @@ int TrackGenerator::getNumThreads() {
 }
 
 
+/**
+ * @brief Returns the order in which the FSRs are numbered after ray tracing.
+ * @return the FSR numbering
+ */
+fsrNumbering TrackGenerator::getFSRNumbering() {
+  return _FSR_numbering;
+}
+
+
 /**
  * @brief Return the number of azimuthal angles in \f$ [0, 2\pi] \f$
  * @return the number of azimuthal angles in \f$ 2\pi \f$
@@ -175,6 +216,116 @@ Track **TrackGenerator::getTracks() {
 }
 
 
+/**
+ * @brief Returns an array of the offsets of each Track's first segment
+ *        into the flat segment arrays.
+ * @details The array is indexed by Track UID and has one more entry than
+ *          the total number of Tracks such that the segments for Track
+ *          with UID i span the range [offsets[i], offsets[i+1]).
+ * @return the array of Track segment offsets
+ */
+int* TrackGenerator::getTrackSegmentOffsets() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the Track segment offsets "
+               "since Tracks have not yet been generated.");
+
+  return _track_segment_offsets;
+}
+
+
+/**
+ * @brief Returns a flat array of the lengths of all segments.
+ * @return the array of segment lengths
+ */
+FP_PRECISION* TrackGenerator::getSegmentLengths() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the segment lengths "
+               "since Tracks have not yet been generated.");
+
+  return _segment_lengths;
+}
+
+
+/**
+ * @brief Returns a flat array of the FSR IDs of all segments.
+ * @return the array of segment FSR IDs
+ */
+int* TrackGenerator::getSegmentFSRIds() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the segment FSR IDs "
+               "since Tracks have not yet been generated.");
+
+  return _segment_fsr_ids;
+}
+
+
+/**
+ * @brief Returns a flat array of the Material indices of all segments.
+ * @details Each index refers to a Material in the array returned by
+ *          TrackGenerator::getSegmentMaterials().
+ * @return the array of segment Material indices
+ */
+int* TrackGenerator::getSegmentMaterialIndices() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the segment Material indices "
+               "since Tracks have not yet been generated.");
+
+  return _segment_material_indices;
+}
+
+
+/**
+ * @brief Returns a flat array of the forward Cmfd Mesh surfaces of all
+ *        segments.
+ * @return the array of forward segment Cmfd Mesh surfaces
+ */
+int* TrackGenerator::getSegmentCmfdSurfacesFwd() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the segment Cmfd Mesh surfaces "
+               "since Tracks have not yet been generated.");
+
+  return _segment_cmfd_surfaces_fwd;
+}
+
+
+/**
+ * @brief Returns a flat array of the reverse Cmfd Mesh surfaces of all
+ *        segments.
+ * @return the array of reverse segment Cmfd Mesh surfaces
+ */
+int* TrackGenerator::getSegmentCmfdSurfacesBwd() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the segment Cmfd Mesh surfaces "
+               "since Tracks have not yet been generated.");
+
+  return _segment_cmfd_surfaces_bwd;
+}
+
+
+/**
+ * @brief Returns an array of the Materials referenced by the segment
+ *        Material indices.
+ * @return the array of segment Materials
+ */
+Material** TrackGenerator::getSegmentMaterials() {
+  if (!_contains_tracks)
+    log_printf(ERROR, "Unable to return the segment Materials "
+               "since Tracks have not yet been generated.");
+
+  return _segment_materials;
+}
+
+
+/**
+ * @brief Returns the number of Materials referenced by the segment
+ *        Material indices.
+ * @return the number of segment Materials
+ */
+int TrackGenerator::getNumSegmentMaterials() {
+  return _num_segment_materials;
+}
+
+
 /**
  * @brief Return a pointer to the array of azimuthal angle quadrature weights.
  * @return the array of azimuthal angle quadrature weights
@@ -263,10 +414,9 @@ void TrackGenerator::retrieveSegmentCoords(double* coords, int num_segments) {
                "but an array of length %d was input",
                getNumSegments(), 5*getNumSegments(), num_segments);
 
-  segment* curr_segment = NULL;
   double x0, x1, y0, y1;
   double phi;
-  segment* segments;
+  int uid;
 
   int counter = 0;
 
@@ -278,19 +428,18 @@ void TrackGenerator::retrieveSegmentCoords(double* coords, int num_segments) {
       x0 = _tracks[i][j].getStart()->getX();
       y0 = _tracks[i][j].getStart()->getY();
       phi = _tracks[i][j].getPhi();
+      uid = _tracks[i][j].getUid();
 
-      segments = _tracks[i][j].getSegments();
-
-      for (int s=0; s < _tracks[i][j].getNumSegments(); s++) {
-        curr_segment = &segments[s];
+      for (int s=_track_segment_offsets[uid];
+           s < _track_segment_offsets[uid+1]; s++) {
 
-        coords[counter] = curr_segment->_region_id;
+        coords[counter] = _segment_fsr_ids[s];
 
         coords[counter+1] = x0;
         coords[counter+2] = y0;
 
-        x1 = x0 + cos(phi) * curr_segment->_length;
-        y1 = y0 + sin(phi) * curr_segment->_length;
+        x1 = x0 + cos(phi) * _segment_lengths[s];
+        y1 = y0 + sin(phi) * _segment_lengths[s];
 
         coords[counter+3] = x1;
         coords[counter+4] = y1;
@@ -430,6 +579,7 @@ void TrackGenerator::generateTracks() {
   }
 
   initializeBoundaryConditions();
+  initializeSegmentArrays();
   return;
 }
 
@@ -984,13 +1134,35 @@ void TrackGenerator::initializeBoundaryConditions() {
 }
 
 
+/**
+ * @brief Compares two Tracks by their estimated ray tracing cost.
+ * @details The cost of ray tracing a Track is estimated by its length. This
+ *          is used to order the Tracks from the most to the least expensive.
+ * @param track1 a pair of a Track's length and a pointer to the Track
+ * @param track2 a pair of a Track's length and a pointer to the Track
+ * @return true if the first Track is longer than the second Track
+ */
+static bool compare_track_lengths(const std::pair<double, Track*>& track1,
+                                  const std::pair<double, Track*>& track2) {
+  return track1.first > track2.first;
+}
+
+
 /**
  * @brief Generate segments for each Track across the Geometry.
+ * @details The Tracks for all azimuthal angles are ray traced in a single
+ *          parallel loop. The Tracks are sorted from the longest to the
+ *          shortest and handed out to the threads with a dynamic schedule
+ *          such that the long Tracks are traced first and the short Tracks
+ *          balance the load between threads at the end of the loop. The
+ *          rate at which each thread generates segments is reported at the
+ *          INFO log level to expose any remaining load imbalance.
  */
 void TrackGenerator::segmentize() {
 
   log_printf(NORMAL, "Ray tracing for track segmentation...");
 
+  ScopedTimer timer("Ray tracing for track segmentation");
   Track* track;
 
   if (_num_segments != NULL)
@@ -1000,17 +1172,85 @@ void TrackGenerator::segmentize() {
    * Tracks were not read in from an input file */
   if (!_use_input_file) {
 
-    /* Loop over all Tracks */
+    /* Flatten the Tracks for all azimuthal angles and sort them from the
+     * longest to the shortest */
+    std::vector< std::pair<double, Track*> > tracks;
+    tracks.reserve(_tot_num_tracks);
+
     for (int i=0; i < _num_azim; i++) {
-      #pragma omp parallel for private(track)
-      for (int j=0; j < _num_tracks[i]; j++){
+      for (int j=0; j < _num_tracks[i]; j++) {
         track = &_tracks[i][j];
-        log_printf(DEBUG, "Segmenting Track %d/%d with i = %d, j = %d",
-        track->getUid(), _tot_num_tracks, i, j);
+        tracks.push_back(std::pair<double, Track*>
+                         (track->getStart()->distanceToPoint(track->getEnd()),
+                          track));
+      }
+    }
+
+    std::stable_sort(tracks.begin(), tracks.end(), compare_track_lengths);
+
+    /* Report the progress of ray tracing in steps of 20% of the Tracks */
+    int num_tracks = (int)tracks.size();
+    int progress_interval = std::max(num_tracks / 5, 1);
+    int num_segmentized = 0;
+
+    /* The number of Tracks, segments and the time spent by each thread */
+    int num_threads = omp_get_max_threads();
+    std::vector<int> thread_tracks(num_threads, 0);
+    std::vector<long> thread_segments(num_threads, 0);
+    std::vector<double> thread_times(num_threads, 0.);
+
+    /* Count the hardware events in ray tracing when built with PAPI */
+    Timer::Get()->startHardwareCounters();
+
+    /* Loop over all Tracks and record the time each thread spends ray
+     * tracing to expose any load imbalance */
+    #pragma omp parallel private(track)
+    {
+      ScopedTimer thread_timer("Ray tracing time summed over threads");
+
+      int thread_id = omp_get_thread_num();
+      double start_time = Timer::getWallTime();
+      int num_thread_tracks = 0;
+      long num_thread_segments = 0;
+      int done;
+
+      #pragma omp for schedule(dynamic) nowait
+      for (int t=0; t < num_tracks; t++) {
+        track = tracks[t].second;
+        log_printf(DEBUG, "Segmenting Track %d/%d with i = %d",
+                   track->getUid(), _tot_num_tracks,
+                   track->getAzimAngleIndex());
         _geometry->segmentize(track,_max_optical_length);
+
+        num_thread_tracks++;
+        num_thread_segments += track->getNumSegments();
+
+        #pragma omp atomic capture
+        done = ++num_segmentized;
+
+        if (done % progress_interval == 0 && done != num_tracks)
+          log_printf(NORMAL, "Segmented %d%% of %d Tracks...",
+                     (int)(100. * done / num_tracks + 0.5), num_tracks);
       }
+
+      thread_tracks[thread_id] = num_thread_tracks;
+      thread_segments[thread_id] = num_thread_segments;
+      thread_times[thread_id] = Timer::getWallTime() - start_time;
+    }
+
+    Timer::Get()->stopHardwareCounters("Ray tracing for track segmentation");
+
+    for (int t=0; t < num_threads; t++) {
+      if (thread_tracks[t] == 0)
+        continue;
+
+      log_printf(INFO, "Thread %d: %d Tracks, %ld segments, "
+                 "%1.4E segments/sec", t, thread_tracks[t],
+                 thread_segments[t], thread_segments[t] / thread_times[t]);
     }
 
+    renumberFSRs();
+
     /* Compute the total number of segments in the simulation */
     _num_segments = new int[_tot_num_tracks];
     _tot_num_segments = 0;
@@ -1030,6 +1270,202 @@ void TrackGenerator::segmentize() {
 }
 
 
+/**
+ * @brief Renumbers the FSRs after ray tracing in the TrackGenerator's FSR
+ *        numbering order and applies the new FSR IDs to each segment.
+ */
+void TrackGenerator::renumberFSRs() {
+
+  ScopedTimer timer("FSR renumbering");
+
+  int num_FSRs = _geometry->getNumFSRs();
+  std::vector<int> new_fsr_ids(num_FSRs);
+  segment* curr_segment;
+  Track* track;
+
+  /* Sort the FSRs by their paths through the CSG hierarchy */
+  if (_FSR_numbering == FSR_NUMBERING_CSG_PATH)
+    new_fsr_ids = _geometry->getFSRRegistry()->getCSGPathOrder();
+
+  /* Number the FSRs in the order they are first crossed by the Tracks */
+  else if (_FSR_numbering == FSR_NUMBERING_TRACK) {
+
+    int fsr_id = 0;
+    std::fill(new_fsr_ids.begin(), new_fsr_ids.end(), -1);
+
+    for (int i=0; i < _num_azim; i++) {
+      for (int j=0; j < _num_tracks[i]; j++) {
+        track = &_tracks[i][j];
+        for (int s=0; s < track->getNumSegments(); s++) {
+          curr_segment = track->getSegment(s);
+          if (new_fsr_ids[curr_segment->_region_id] == -1)
+            new_fsr_ids[curr_segment->_region_id] = fsr_id++;
+        }
+      }
+    }
+
+    /* Number any FSRs not crossed by a Track last */
+    for (int r=0; r < num_FSRs; r++) {
+      if (new_fsr_ids[r] == -1)
+        new_fsr_ids[r] = fsr_id++;
+    }
+  }
+
+  /* Keep the FSR IDs in order of discovery */
+  else {
+    for (int r=0; r < num_FSRs; r++)
+      new_fsr_ids[r] = r;
+  }
+
+  _geometry->renumberFSRs(new_fsr_ids);
+
+  if (_FSR_numbering == FSR_NUMBERING_DISCOVERY)
+    return;
+
+  /* Apply the new FSR IDs to each segment */
+  for (int i=0; i < _num_azim; i++) {
+    #pragma omp parallel for private(track, curr_segment)
+    for (int j=0; j < _num_tracks[i]; j++) {
+      track = &_tracks[i][j];
+      for (int s=0; s < track->getNumSegments(); s++) {
+        curr_segment = track->getSegment(s);
+        curr_segment->_region_id = new_fsr_ids[curr_segment->_region_id];
+      }
+    }
+  }
+}
+
+
+/**
+ * @brief Copies the segment data from all Tracks into flat arrays.
+ * @details The segments for all Tracks are stored contiguously in Track UID
+ *          order in a structure-of-arrays layout which is streamed through
+ *          by the Solvers during each transport sweep. The segment Materials
+ *          are replaced by indices into a compact array of Materials. The
+ *          segments stored by each Track are released once they have been
+ *          copied such that the segment data is not held twice in memory.
+ */
+void TrackGenerator::initializeSegmentArrays() {
+
+  clearSegmentArrays();
+
+  std::map<int, Material*> materials = _geometry->getAllMaterials();
+  std::map<int, Material*>::iterator iter;
+  std::map<int, int> material_indices;
+  bool cmfd = (_geometry->getCmfd() != NULL);
+  segment* curr_segment;
+  Track* curr_track;
+  int uid, offset, num_segments;
+
+  try {
+    _track_segment_offsets = new int[_tot_num_tracks+1];
+    _segment_lengths = new FP_PRECISION[_tot_num_segments];
+    _segment_fsr_ids = new int[_tot_num_segments];
+    _segment_material_indices = new int[_tot_num_segments];
+    _segment_cmfd_surfaces_fwd = new int[_tot_num_segments];
+    _segment_cmfd_surfaces_bwd = new int[_tot_num_segments];
+    _segment_materials = new Material*[materials.size()];
+  }
+  catch (std::exception &e) {
+    log_printf(ERROR, "Unable to allocate memory for the segment arrays. "
+               "Backtrace:\n%s", e.what());
+  }
+
+  /* Assign each Material an index in the compact Material array */
+  _num_segment_materials = 0;
+  for (iter = materials.begin(); iter != materials.end(); ++iter) {
+    material_indices[iter->first] = _num_segment_materials;
+    _segment_materials[_num_segment_materials] = iter->second;
+    _num_segment_materials++;
+  }
+
+  /* Compute the offset for the first segment of each Track */
+  _track_segment_offsets[0] = 0;
+  for (uid=0; uid < _tot_num_tracks; uid++)
+    _track_segment_offsets[uid+1] = _track_segment_offsets[uid] +
+                                    _num_segments[uid];
+
+  /* Copy the data for each segment into the flat arrays */
+  for (int i=0; i < _num_azim; i++) {
+
+    #pragma omp parallel for private(curr_track, curr_segment, uid, \
+                                     offset, num_segments)
+    for (int j=0; j < _num_tracks[i]; j++) {
+
+      curr_track = &_tracks[i][j];
+      uid = curr_track->getUid();
+      offset = _track_segment_offsets[uid];
+      num_segments = curr_track->getNumSegments();
+
+      for (int s=0; s < num_segments; s++) {
+        curr_segment = curr_track->getSegment(s);
+        _segment_lengths[offset+s] = curr_segment->_length;
+        _segment_fsr_ids[offset+s] = curr_segment->_region_id;
+        _segment_material_indices[offset+s] =
+            material_indices.at(curr_segment->_material->getId());
+
+        if (cmfd) {
+          _segment_cmfd_surfaces_fwd[offset+s] =
+              curr_segment->_cmfd_surface_fwd;
+          _segment_cmfd_surfaces_bwd[offset+s] =
+              curr_segment->_cmfd_surface_bwd;
+        }
+        else {
+          _segment_cmfd_surfaces_fwd[offset+s] = -1;
+          _segment_cmfd_surfaces_bwd[offset+s] = -1;
+        }
+      }
+
+      curr_track->clearSegments();
+    }
+  }
+
+  log_printf(INFO, "Flat segment arrays for %d segments require %.2f MB "
+             "of memory", _tot_num_segments, (_tot_num_segments *
+             (sizeof(FP_PRECISION) + 4 * sizeof(int)) +
+             (_tot_num_tracks+1) * sizeof(int)) / 1.E6);
+
+  return;
+}
+
+
+/**
+ * @brief Deletes the flat segment arrays if they have been allocated.
+ */
+void TrackGenerator::clearSegmentArrays() {
+
+  if (_track_segment_offsets != NULL)
+    delete [] _track_segment_offsets;
+
+  if (_segment_lengths != NULL)
+    delete [] _segment_lengths;
+
+  if (_segment_fsr_ids != NULL)
+    delete [] _segment_fsr_ids;
+
+  if (_segment_material_indices != NULL)
+    delete [] _segment_material_indices;
+
+  if (_segment_cmfd_surfaces_fwd != NULL)
+    delete [] _segment_cmfd_surfaces_fwd;
+
+  if (_segment_cmfd_surfaces_bwd != NULL)
+    delete [] _segment_cmfd_surfaces_bwd;
+
+  if (_segment_materials != NULL)
+    delete [] _segment_materials;
+
+  _track_segment_offsets = NULL;
+  _segment_lengths = NULL;
+  _segment_fsr_ids = NULL;
+  _segment_material_indices = NULL;
+  _segment_cmfd_surfaces_fwd = NULL;
+  _segment_cmfd_surfaces_bwd = NULL;
+  _segment_materials = NULL;
+  _num_segment_materials = 0;
+}
+
+
 /**
  * @brief Writes all Track and segment data to a "*.tracks" binary file.
  * @details Storing Tracks in a binary file saves time by eliminating ray
@@ -1047,6 +1483,14 @@ void TrackGenerator::dumpTracksToFile() {
   FILE* out;
   out = fopen(_tracks_filename.c_str(), "w");
 
+  /* Write the Track file identifier and layout version */
+  int magic = TRACK_FILE_MAGIC;
+  int version = TRACK_FILE_VERSION;
+  int numbering = _FSR_numbering;
+  fwrite(&magic, sizeof(int), 1, out);
+  fwrite(&version, sizeof(int), 1, out);
+  fwrite(&numbering, sizeof(int), 1, out);
+
   /* Get a string representation of the Geometry's attributes. This is used to
    * check whether or not ray tracing has been performed for this Geometry */
   std::string geometry_to_string = _geometry->toString();
@@ -1133,41 +1577,30 @@ void TrackGenerator::dumpTracksToFile() {
     }
   }
 
-  /* Get FSR vector maps */
-  std::unordered_map<std::size_t, fsr_data> FSR_keys_map = _geometry->getFSRKeysMap();
-  std::unordered_map<std::size_t, fsr_data>::iterator iter;
-  std::vector<std::size_t> FSRs_to_keys = _geometry->getFSRsToKeys();
-  std::vector<int> FSRs_to_material_IDs = _geometry->getFSRsToMaterialIDs();
-  std::size_t fsr_key;
-  int fsr_id;
-  int fsr_counter = 0;
+  /* Get the FSR registry */
+  FSRRegistry* FSR_registry = _geometry->getFSRRegistry();
+  int fsr_material_id;
+  int key_length;
   double x, y;
 
   /* Write number of FSRs */
   int num_FSRs = _geometry->getNumFSRs();
   fwrite(&num_FSRs, sizeof(int), 1, out);
 
-  /* Write FSR vector maps to file */
-  for (iter = FSR_keys_map.begin(); iter != FSR_keys_map.end(); ++iter){
+  /* Write the packed key, characteristic point and Material of each FSR
+   * in order of FSR ID */
+  for (int fsr_id=0; fsr_id < num_FSRs; fsr_id++){
 
-    /* Write data to file from FSR_keys_map */
-    fsr_key = iter->first;
-    fsr_id = iter->second._fsr_id;
-    x = iter->second._point->getX();
-    y = iter->second._point->getY();
-    fwrite(&fsr_key, sizeof(std::size_t), 1, out);
-    fwrite(&fsr_id, sizeof(int), 1, out);
+    std::vector<int>& key = FSR_registry->getFSRKeyValues(fsr_id);
+    key_length = key.size();
+    x = FSR_registry->getFSRPoint(fsr_id)->getX();
+    y = FSR_registry->getFSRPoint(fsr_id)->getY();
+    fsr_material_id = FSR_registry->getFSRMaterialId(fsr_id);
+    fwrite(&key_length, sizeof(int), 1, out);
+    fwrite(&key[0], sizeof(int), key_length, out);
     fwrite(&x, sizeof(double), 1, out);
     fwrite(&y, sizeof(double), 1, out);
-
-    /* Write data to file from FSRs_to_material_IDs */
-    fwrite(&(FSRs_to_material_IDs.at(fsr_counter)), sizeof(int), 1, out);
-
-    /* Write data to file from FSRs_to_keys */
-    fwrite(&(FSRs_to_keys.at(fsr_counter)), sizeof(std::size_t), 1, out);
-
-    /* Increment FSR ID counter */
-    fsr_counter++;
+    fwrite(&fsr_material_id, sizeof(int), 1, out);
   }
 
   /* Write cmfd_fsrs vector of vectors to file */
@@ -1221,12 +1654,35 @@ bool TrackGenerator::readTracksFromFile() {
       delete [] _tracks[i];
 
     delete [] _tracks;
+    _contains_tracks = false;
   }
 
   int ret;
   FILE* in;
   in = fopen(_tracks_filename.c_str(), "r");
 
+  /* Check that the Track file was written with the current layout */
+  int magic, version, numbering;
+  ret = fread(&magic, sizeof(int), 1, in);
+  ret = fread(&version, sizeof(int), 1, in);
+
+  if (magic != TRACK_FILE_MAGIC || version != TRACK_FILE_VERSION) {
+    log_printf(NORMAL, "Ignoring the Track file %s written with an outdated "
+               "layout", _tracks_filename.c_str());
+    fclose(in);
+    return false;
+  }
+
+  /* Check that the FSRs in the Track file were numbered in the same order */
+  ret = fread(&numbering, sizeof(int), 1, in);
+
+  if (numbering != _FSR_numbering) {
+    log_printf(NORMAL, "Ignoring the Track file %s written with a different "
+               "FSR numbering", _tracks_filename.c_str());
+    fclose(in);
+    return false;
+  }
+
   int string_length;
 
   /* Import Geometry metadata from the Track file */
@@ -1310,7 +1766,7 @@ bool TrackGenerator::readTracksFromFile() {
       ret = fread(&num_segments, sizeof(int), 1, in);
 
       _tot_num_segments += num_segments;
-      _num_segments[uid] += num_segments;
+      _num_segments[uid] = num_segments;
 
       /* Initialize a Track with this data */
       curr_track = &_tracks[i][j];
@@ -1347,48 +1803,35 @@ bool TrackGenerator::readTracksFromFile() {
     }
   }
 
-  /* Create FSR vector maps */
-  std::unordered_map<std::size_t, fsr_data> FSR_keys_map;
-  std::vector<int> FSRs_to_material_IDs;
-  std::vector<std::size_t> FSRs_to_keys;
+  /* Get the FSR registry */
+  FSRRegistry* FSR_registry = _geometry->getFSRRegistry();
   int num_FSRs;
-  std::size_t fsr_key;
-  int fsr_key_id;
+  fsr_key key;
   double x, y;
 
   /* Get number of FSRs */
   ret = fread(&num_FSRs, sizeof(int), 1, in);
-  _geometry->setNumFSRs(num_FSRs);
+  FSR_registry->clear();
 
-  /* Read FSR vector maps from file */
+  /* Read the packed key, characteristic point and Material of each FSR in
+   * order of FSR ID and add the FSR to the Geometry's FSR registry */
   for (int fsr_id=0; fsr_id < num_FSRs; fsr_id++){
 
-    /* Read data from file for FSR_keys_map */
-    ret = fread(&fsr_key, sizeof(std::size_t), 1, in);
-    ret = fread(&fsr_key_id, sizeof(int), 1, in);
+    ret = fread(&key._length, sizeof(int), 1, in);
+
+    if (key._length < 1 || key._length > MAX_FSR_KEY_LENGTH)
+      log_printf(ERROR, "Unable to read FSR %d from the Track file since its "
+                 "key has %d integers", fsr_id, key._length);
+
+    ret = fread(key._values, sizeof(int), key._length, in);
+    hash_fsr_key(&key);
+
     ret = fread(&x, sizeof(double), 1, in);
     ret = fread(&y, sizeof(double), 1, in);
-    fsr_data* fsr = new fsr_data;
-    fsr->_fsr_id = fsr_key_id;
-    Point* point = new Point();
-    point->setCoords(x,y);
-    fsr->_point = point;
-    FSR_keys_map[fsr_key] = *fsr;
-
-    /* Read data from file for FSR_to_materials_IDs */
     ret = fread(&material_id, sizeof(int), 1, in);
-    FSRs_to_material_IDs.push_back(material_id);
-
-    /* Read data from file for FSR_to_keys */
-    ret = fread(&fsr_key, sizeof(std::size_t), 1, in);
-    FSRs_to_keys.push_back(fsr_key);
+    FSR_registry->addFSR(&key, fsr_id, x, y, material_id);
   }
 
-  /* Set FSR vector maps */
-  _geometry->setFSRKeysMap(FSR_keys_map);
-  _geometry->setFSRsToMaterialIDs(FSRs_to_material_IDs);
-  _geometry->setFSRsToKeys(FSRs_to_keys);
-
   /* Read cmfd cell_fsrs vector of vectors from file */
   if (cmfd != NULL){
     std::vector< std::vector<int> > cell_fsrs;
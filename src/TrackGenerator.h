@@ -15,12 +15,43 @@
 #include <fstream>
 #include <sstream>
 #include <unistd.h>
+#include <algorithm>
+#include <utility>
 #include <omp.h>
 #include "Track.h"
 #include "Geometry.h"
+#include "Timer.h"
 #endif
 
 
+/** The identifier at the start of each Track file */
+#define TRACK_FILE_MAGIC 0x544d4f43
+
+/** The version of the Track file layout, which must be incremented when the
+ *  layout changes such that outdated Track files are regenerated */
+#define TRACK_FILE_VERSION 3
+
+
+/**
+ * @enum fsrNumbering
+ * @brief The orders in which the FSRs may be numbered after ray tracing.
+ */
+enum fsrNumbering {
+
+  /** The order in which the threads discover the FSRs during ray tracing,
+   *  which may change between runs and thread counts */
+  FSR_NUMBERING_DISCOVERY,
+
+  /** The lexicographic order of the FSRs' paths through the CSG hierarchy,
+   *  which only depends on the Geometry */
+  FSR_NUMBERING_CSG_PATH,
+
+  /** The order in which the Tracks, in order of Track UID, first cross the
+   *  FSRs, which improves the locality of FSR data in transport sweeps */
+  FSR_NUMBERING_TRACK
+};
+
+
 /**
  * @class TrackGenerator TrackGenerator.h "src/TrackGenerator.h"
  * @brief The TrackGenerator is dedicated to generating and storing Tracks
@@ -70,6 +101,34 @@ private:
   /** A 2D ragged array of Tracks */
   Track** _tracks;
 
+  /** An array of the offset of each Track's first segment into the flat
+   *  segment arrays indexed by Track UID (with one extra trailing entry) */
+  int* _track_segment_offsets;
+
+  /** A flat array of the lengths for all segments */
+  FP_PRECISION* _segment_lengths;
+
+  /** A flat array of the FSR IDs for all segments */
+  int* _segment_fsr_ids;
+
+  /** A flat array of the indices into the segment Materials array for
+   *  all segments */
+  int* _segment_material_indices;
+
+  /** A flat array of the Cmfd Mesh surfaces crossed at the end of each
+   *  segment in the forward direction (-1 if none) */
+  int* _segment_cmfd_surfaces_fwd;
+
+  /** A flat array of the Cmfd Mesh surfaces crossed at the end of each
+   *  segment in the reverse direction (-1 if none) */
+  int* _segment_cmfd_surfaces_bwd;
+
+  /** An array of the Materials referenced by the segment Material indices */
+  Material** _segment_materials;
+
+  /** The number of Materials referenced by the segment Material indices */
+  int _num_segment_materials;
+
   /** Pointer to the Geometry */
   Geometry* _geometry;
 
@@ -82,6 +141,9 @@ private:
   /** Boolean whether the Tracks have been generated (true) or not (false) */
   bool _contains_tracks;
 
+  /** The order in which the FSRs are numbered after ray tracing */
+  fsrNumbering _FSR_numbering;
+
   void computeEndPoint(Point* start, Point* end,  const double phi,
                        const double width, const double height);
 
@@ -90,6 +152,9 @@ private:
   void recalibrateTracksToOrigin();
   void initializeBoundaryConditions();
   void segmentize();
+  void renumberFSRs();
+  void initializeSegmentArrays();
+  void clearSegmentArrays();
   void dumpTracksToFile();
   bool readTracksFromFile();
 
@@ -106,11 +171,20 @@ public:
   int getNumSegments();
   int* getNumSegmentsArray();
   Track** getTracks();
+  int* getTrackSegmentOffsets();
+  FP_PRECISION* getSegmentLengths();
+  int* getSegmentFSRIds();
+  int* getSegmentMaterialIndices();
+  int* getSegmentCmfdSurfacesFwd();
+  int* getSegmentCmfdSurfacesBwd();
+  Material** getSegmentMaterials();
+  int getNumSegmentMaterials();
   FP_PRECISION* getAzimWeights();
   FP_PRECISION getMaxOpticalLength();
   int getTotNumSegments();
   int getTotNumTracks();
   int getNumThreads();
+  fsrNumbering getFSRNumbering();
 
   /* Set parameters */
   void setNumAzim(int num_azim);
@@ -118,6 +192,7 @@ public:
   void setGeometry(Geometry* geometry);
   void setMaxOpticalLength(FP_PRECISION max_optical_length);
   void setNumThreads(int num_threads);
+  void setFSRNumbering(fsrNumbering numbering);
 
   /* Worker functions */
   bool containsTracks();
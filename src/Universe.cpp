@@ -55,6 +55,9 @@ Universe::Universe(const int id, const char* name) {
 
   /* By default, the Universe's fissionability is unknown */
   _fissionable = false;
+
+  _num_x_bins = 0;
+  _num_y_bins = 0;
 }
 
 
@@ -561,6 +564,7 @@ void Universe::addCell(Cell* cell) {
 
   try {
     _cells.insert(std::pair<int, Cell*>(cell->getId(), cell));
+    clearCellBins();
     log_printf(INFO, "Added Cell with ID = %d to Universe with ID = %d",
                cell->getId(), _id);
   }
@@ -578,6 +582,8 @@ void Universe::addCell(Cell* cell) {
 void Universe::removeCell(Cell* cell) {
   if (_cells.find(cell->getId()) != _cells.end())
     _cells.erase(cell->getId());
+
+  clearCellBins();
 }
 
 
@@ -591,56 +597,211 @@ void Universe::removeCell(Cell* cell) {
  */
 Cell* Universe::findCell(LocalCoords* coords) {
 
-  Cell* return_cell = NULL;
   Cell* cell;
-  std::map<int, Cell*>::iterator iter;
 
   /* Sets the LocalCoord type to UNIV at this level */
   coords->setType(UNIV);
 
-  /* Loop over all Cells in this Universe */
+  /* Loop over all Cells in this Universe if the Cell bins are not built */
+  if (_num_x_bins == 0) {
+
+    std::map<int, Cell*>::iterator iter;
+
+    for (iter = _cells.begin(); iter != _cells.end(); ++iter) {
+      cell = iter->second;
+
+      if (cell->cellContainsCoords(coords))
+        return enterCell(cell, coords);
+    }
+
+    return NULL;
+  }
+
+  /* Find the Cell bin containing the coords */
+  std::vector<Cell*>* cells;
+  int bin_x = (int)floor((coords->getX() - _bins_min_x) / _bin_width_x);
+  int bin_y = (int)floor((coords->getY() - _bins_min_y) / _bin_width_y);
+
+  if (bin_x < 0 || bin_x >= _num_x_bins || bin_y < 0 || bin_y >= _num_y_bins)
+    cells = &_outside_cells;
+  else
+    cells = &_cell_bins[bin_y * _num_x_bins + bin_x];
+
+  /* Loop over the Cells which may overlap the Cell bin */
+  std::vector<Cell*>::iterator iter;
+
+  for (iter = cells->begin(); iter != cells->end(); ++iter) {
+    cell = *iter;
+
+    if (cell->cellContainsCoords(coords))
+      return enterCell(cell, coords);
+  }
+
+  return NULL;
+}
+
+
+/**
+ * @brief Sets the Cell containing a LocalCoords and continues the search for
+ *        the lowest level Cell in the Cell's fill.
+ * @param cell a pointer to the Cell containing the coords
+ * @param coords a pointer to the coords of interest
+ * @return a pointer to the lowest level Cell containing the coords
+ */
+Cell* Universe::enterCell(Cell* cell, LocalCoords* coords) {
+
+  /* Set the Cell on this level */
+  coords->setCell(cell);
+
+  /* MATERIAL type Cell - lowest level, terminate search for Cell */
+  if (cell->getType() == MATERIAL)
+    return cell;
+
+  /* FILL type Cell - Cell contains a Universe at a lower level
+   * Update coords to next level and continue search */
+  LocalCoords* next_coords;
+
+  if (coords->getNext() == NULL)
+    next_coords = new LocalCoords(coords->getX(), coords->getY());
+  else
+    next_coords = coords->getNext();
+
+  CellFill* fill = static_cast<CellFill*>(cell);
+  Universe* univ = fill->getFill();
+  next_coords->setUniverse(univ);
+
+  coords->setNext(next_coords);
+  next_coords->setPrev(coords);
+  if (univ->getType() == SIMPLE)
+    return univ->findCell(next_coords);
+  else
+    return static_cast<Lattice*>(univ)->findCell(next_coords);
+}
+
+
+/**
+ * @brief Bins the Universe's Cells on a uniform grid to accelerate
+ *        Universe::findCell(...).
+ * @details The grid spans the finite bounding boxes of the Cells. Each bin
+ *          stores the Cells which may overlap it, as determined by
+ *          Cell::cellOverlapsBox(...), such that Cells which are separated
+ *          from the bin by one of their Surfaces (ie, the rings and sectors
+ *          of a pin) are not tested for Points in the bin. Points outside
+ *          of the grid are tested against the Cells with unbounded or
+ *          partially bounded bounding boxes. Each list keeps the Cells in
+ *          Cell ID order such that the same Cell is found as by a linear
+ *          search over all Cells. The bins are cleared when Cells are added
+ *          or removed. This method is called by
+ *          Geometry::initializeFlatSourceRegions() once the Cells have been
+ *          subdivided into rings and sectors.
+ */
+void Universe::buildCellBins() {
+
+  clearCellBins();
+
+  if (_cells.size() < 2)
+    return;
+
+  double inf = std::numeric_limits<double>::infinity();
+  double min_x = inf;
+  double max_x = -inf;
+  double min_y = inf;
+  double max_y = -inf;
+  double bounds[4];
+  Cell* cell;
+  std::map<int, Cell*>::iterator iter;
+
+  /* Find the extent of the finite bounds of the Cells */
   for (iter = _cells.begin(); iter != _cells.end(); ++iter) {
     cell = iter->second;
+    bounds[0] = cell->getMinX();
+    bounds[1] = cell->getMaxX();
+    bounds[2] = cell->getMinY();
+    bounds[3] = cell->getMaxY();
+
+    for (int i=0; i < 2; i++) {
+      if (std::abs(bounds[i]) != inf) {
+        min_x = std::min(min_x, bounds[i]);
+        max_x = std::max(max_x, bounds[i]);
+      }
+      if (std::abs(bounds[i+2]) != inf) {
+        min_y = std::min(min_y, bounds[i+2]);
+        max_y = std::max(max_y, bounds[i+2]);
+      }
+    }
+  }
 
-    if (cell->cellContainsCoords(coords)) {
+  /* Do not bin the Cells if the Cells have no finite extent */
+  if (!(max_x > min_x) || !(max_y > min_y))
+    return;
 
-      /* Set the Cell on this level */
-      coords->setCell(cell);
+  /* Use roughly four bins per Cell */
+  int num_bins = 2 * (int)ceil(sqrt((double)_cells.size()));
+  num_bins = std::min(num_bins, MAX_CELL_BINS);
 
-      /* MATERIAL type Cell - lowest level, terminate search for Cell */
-      if (cell->getType() == MATERIAL) {
-        coords->setCell(cell);
-        return_cell = cell;
-        return return_cell;
-      }
+  _num_x_bins = num_bins;
+  _num_y_bins = num_bins;
+  _bins_min_x = min_x - CELL_BIN_PADDING;
+  _bins_min_y = min_y - CELL_BIN_PADDING;
+  _bin_width_x = (max_x - min_x + 2 * CELL_BIN_PADDING) / num_bins;
+  _bin_width_y = (max_y - min_y + 2 * CELL_BIN_PADDING) / num_bins;
+  _cell_bins.resize(_num_x_bins * _num_y_bins);
 
-      /* FILL type Cell - Cell contains a Universe at a lower level
-       * Update coords to next level and continue search */
-      else if (cell->getType() == FILL) {
+  /* Find the Cells which may overlap each bin */
+  for (int j=0; j < _num_y_bins; j++) {
+    for (int i=0; i < _num_x_bins; i++) {
 
-        LocalCoords* next_coords;
+      double bin_min_x = _bins_min_x + i * _bin_width_x - CELL_BIN_PADDING;
+      double bin_max_x = _bins_min_x + (i+1) * _bin_width_x + CELL_BIN_PADDING;
+      double bin_min_y = _bins_min_y + j * _bin_width_y - CELL_BIN_PADDING;
+      double bin_max_y = _bins_min_y + (j+1) * _bin_width_y + CELL_BIN_PADDING;
 
-        if (coords->getNext() == NULL)
-          next_coords = new LocalCoords(coords->getX(), coords->getY());
-        else
-          next_coords = coords->getNext();
+      for (iter = _cells.begin(); iter != _cells.end(); ++iter) {
+        cell = iter->second;
 
-        CellFill* fill = static_cast<CellFill*>(cell);
-        Universe* univ = fill->getFill();
-        next_coords->setUniverse(univ);
-        coords->setCell(cell);
+        if (cell->getMinX() > bin_max_x || cell->getMaxX() < bin_min_x ||
+            cell->getMinY() > bin_max_y || cell->getMaxY() < bin_min_y)
+          continue;
 
-        coords->setNext(next_coords);
-        next_coords->setPrev(coords);
-        if (univ->getType() == SIMPLE)
-          return univ->findCell(next_coords);
-        else
-          return static_cast<Lattice*>(univ)->findCell(next_coords);
+        if (cell->cellOverlapsBox(bin_min_x, bin_max_x, bin_min_y, bin_max_y))
+          _cell_bins[j * _num_x_bins + i].push_back(cell);
       }
     }
   }
 
-  return return_cell;
+  /* Find the Cells which may extend beyond the bins */
+  for (iter = _cells.begin(); iter != _cells.end(); ++iter) {
+    cell = iter->second;
+
+    if (cell->getMinX() < min_x || cell->getMaxX() > max_x ||
+        cell->getMinY() < min_y || cell->getMaxY() > max_y)
+      _outside_cells.push_back(cell);
+  }
+
+  log_printf(DEBUG, "Binned %d Cells in Universe %d on a %d x %d grid",
+             (int)_cells.size(), _id, _num_x_bins, _num_y_bins);
+}
+
+
+/**
+ * @brief Clears the Cell bins such that Universe::findCell(...) loops over
+ *        all Cells in the Universe.
+ */
+void Universe::clearCellBins() {
+  _num_x_bins = 0;
+  _num_y_bins = 0;
+  _cell_bins.clear();
+  _outside_cells.clear();
+}
+
+
+/**
+ * @brief Returns the number of Cell bins used to accelerate
+ *        Universe::findCell(...).
+ * @return the number of Cell bins (0 if the Cells are not binned)
+ */
+int Universe::getNumCellBins() {
+  return _num_x_bins * _num_y_bins;
 }
 
 
@@ -10,6 +10,8 @@
 
 #ifdef __cplusplus
 #include <limits>
+#include <cmath>
+#include <algorithm>
 #include <map>
 #include <vector>
 #include "LocalCoords.h"
@@ -24,6 +26,13 @@
  * Track segmentation */
 #define TINY_MOVE 1E-10
 
+/** The maximum number of Cell bins along each axis of a Universe */
+#define MAX_CELL_BINS 64
+
+/** Distance by which each Cell bin is padded when finding the Cells which
+ *  overlap it, such that Points on the edges of the bins are found */
+#define CELL_BIN_PADDING 1E-8
+
 /* Forward declarations to resolve circular dependencies */
 class LocalCoords;
 class Cell;
@@ -85,6 +94,32 @@ protected:
    *  with a non-zero fission cross-section and is fissionable */
   bool _fissionable;
 
+  /** The number of Cell bins along the x-axis (0 if not built) */
+  int _num_x_bins;
+
+  /** The number of Cell bins along the y-axis (0 if not built) */
+  int _num_y_bins;
+
+  /** The minimum x-coordinate of the Cell bins */
+  double _bins_min_x;
+
+  /** The minimum y-coordinate of the Cell bins */
+  double _bins_min_y;
+
+  /** The width of each Cell bin along the x-axis */
+  double _bin_width_x;
+
+  /** The width of each Cell bin along the y-axis */
+  double _bin_width_y;
+
+  /** The Cells which may overlap each Cell bin, in Cell ID order */
+  std::vector< std::vector<Cell*> > _cell_bins;
+
+  /** The Cells which may extend beyond the Cell bins, in Cell ID order */
+  std::vector<Cell*> _outside_cells;
+
+  Cell* enterCell(Cell* cell, LocalCoords* coords);
+
 public:
 
   Universe(const int id=0, const char* name="");
@@ -122,6 +157,9 @@ public:
   void removeCell(Cell* cell);
 
   Cell* findCell(LocalCoords* coords);
+  void buildCellBins();
+  void clearCellBins();
+  int getNumCellBins();
   void setFissionability(bool fissionable);
   double minSurfaceDist(Point* point, double angle);
   void subdivideCells();
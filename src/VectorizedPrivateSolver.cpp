@@ -0,0 +1,231 @@
+#include "VectorizedPrivateSolver.h"
+
+
+/**
+ * @brief Constructor initializes empty arrays for source, flux, etc.
+ * @details The construcor retrieves the number of energy groups and FSRs
+ *          and azimuthal angles from the Geometry and TrackGenerator if
+ *          they were provided by the user, and uses this to initialize
+ *          empty arrays for the FSRs, boundary angular fluxes, FSR scalar
+ *          fluxes, FSR sources and FSR fission rates. The constructor
+ *          initalizes the number of threads to a default of 1.
+ * @param geometry an optional pointer to the Geometry object
+ * @param track_generator an optional pointer to a TrackGenerator object
+ */
+VectorizedPrivateSolver::VectorizedPrivateSolver(Geometry* geometry,
+                                                 TrackGenerator* track_generator)
+  : VectorizedSolver(geometry, track_generator) {
+
+  _thread_flux = NULL;
+}
+
+
+/**
+ * @brief Destructor deletes the thread private FSR scalar flux array and
+ *        calls the VectorizedSolver parent class destructor.
+ */
+VectorizedPrivateSolver::~VectorizedPrivateSolver() {
+
+  if (_thread_flux != NULL) {
+    MM_FREE(_thread_flux);
+    _thread_flux = NULL;
+  }
+}
+
+
+/**
+ * @brief Allocates memory for Track boundary angular fluxes and leakages
+ *        and FSR scalar fluxes.
+ * @details Deletes memory for old flux arrays if they were allocated for a
+ *          previous simulation. This method allocates an aligned copy of
+ *          the FSR scalar flux array for each thread.
+ */
+void VectorizedPrivateSolver::initializeFluxArrays() {
+
+  VectorizedSolver::initializeFluxArrays();
+
+  /* Delete old thread private flux array if it exists */
+  if (_thread_flux != NULL)
+    MM_FREE(_thread_flux);
+
+  long size = (long)_num_threads * _num_FSRs * _num_groups *
+      sizeof(FP_PRECISION);
+
+  /* Allocate aligned memory for the thread private FSR scalar fluxes */
+  try{
+    _thread_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+  }
+  catch(std::exception &e) {
+    log_printf(ERROR, "Could not allocate memory for the "
+               "VectorizedPrivateSolver's thread private scalar fluxes. "
+               "Backtrace:%s", e.what());
+  }
+
+  log_printf(INFO, "Thread private FSR scalar fluxes for %d threads require "
+             "%.2f MB of memory", _num_threads, size / 1.E6);
+}
+
+
+/**
+ * @brief Set the thread private FSR scalar flux for each FSR and energy
+ *        group to some value.
+ * @param value the value to assign to each thread private FSR scalar flux
+ */
+void VectorizedPrivateSolver::flattenThreadFluxes(FP_PRECISION value) {
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+    for (int t=0; t < _num_threads; t++) {
+
+      FP_PRECISION* thread_flux = &_thread_flux(t,r,0);
+
+      /* Loop over each energy group vector length */
+      for (int v=0; v < _num_vector_lengths; v++) {
+
+        /* Loop over energy groups within this vector */
+        #pragma omp simd
+        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+          thread_flux[e] = value;
+      }
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief This method performs one transport sweep of all azimuthal angles,
+ *        Tracks, Track segments, polar angles and energy groups.
+ * @details The thread private FSR scalar fluxes are zeroed before the
+ *          VectorizedSolver's transport sweep and reduced into the global
+ *          array afterwards. The thread private array is not used for
+ *          reproducible flux updates.
+ */
+void VectorizedPrivateSolver::transportSweep() {
+
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE) {
+    VectorizedSolver::transportSweep();
+    return;
+  }
+
+  /* Initialize the thread private FSR scalar fluxes to zero */
+  flattenThreadFluxes(0.0);
+
+  VectorizedSolver::transportSweep();
+
+  /* Reduce the thread private FSR scalar fluxes */
+  reduceThreadScalarFluxes();
+
+  return;
+}
+
+
+/**
+ * @brief Computes the contribution to the FSR scalar flux from a Track segment.
+ * @details This method integrates the angular flux for a Track segment across
+ *        energy groups and polar angles, and tallies it into the thread
+ *        private FSR scalar flux without any locks or atomics, and updates
+ *        the Track's angular flux.
+ * @param segment_id the index of the segment in the flat segment arrays
+ * @param azim_index a pointer to the azimuthal angle index for this segment
+ * @param track_flux a pointer to the Track's angular flux
+ * @param fsr_flux a pointer to the temporary FSR flux buffer
+ * @param fwd
+ */
+void VectorizedPrivateSolver::scalarFluxTally(int segment_id,
+                                              int azim_index,
+                                              FP_PRECISION* track_flux,
+                                              FP_PRECISION* fsr_flux,
+                                              bool fwd){
+
+  /* Reproducible flux updates store the contribution for each segment */
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE) {
+    VectorizedSolver::scalarFluxTally(segment_id, azim_index, track_flux,
+                                      fsr_flux, fwd);
+    return;
+  }
+
+  int tid = omp_get_thread_num();
+  int fsr_id = _segment_fsr_ids[segment_id];
+  FP_PRECISION* delta_psi = &_delta_psi[tid*_num_groups];
+  FP_PRECISION* reduced_sources = &_reduced_sources(fsr_id,0);
+  FP_PRECISION* thread_flux = &_thread_flux(tid,fsr_id,0);
+  FP_PRECISION* exponentials;
+  FP_PRECISION* polar_flux;
+  FP_PRECISION* polar_exponentials;
+  FP_PRECISION weight;
+
+  /* Use the stored exponentials if they were precomputed */
+  if (_exponentials != NULL)
+    exponentials = &_exponentials[(long)segment_id*_polar_times_groups];
+  else {
+    exponentials = &_thread_exponentials[tid*_polar_times_groups];
+    computeExponentials(segment_id, exponentials);
+  }
+
+  /* Tally the flux contribution from segment to FSR's scalar flux */
+  /* Loop over polar angles */
+  for (int p=0; p < _num_polar; p++){
+
+    polar_flux = &track_flux(p,0);
+    polar_exponentials = &exponentials(p,0);
+    weight = _polar_weights(azim_index,p);
+
+    /* Loop over each energy group vector length */
+    for (int v=0; v < _num_vector_lengths; v++) {
+
+      /* Loop over energy groups within this vector */
+      #pragma omp simd
+      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+        delta_psi[e] = polar_flux[e] - reduced_sources[e];
+
+      /* Loop over energy groups within this vector */
+      #pragma omp simd
+      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+        delta_psi[e] *= polar_exponentials[e];
+
+      /* Loop over energy groups within this vector */
+      #pragma omp simd
+      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+        thread_flux[e] += delta_psi[e] * weight;
+
+      /* Loop over energy groups within this vector */
+      #pragma omp simd
+      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+        polar_flux[e] -= delta_psi[e];
+    }
+  }
+
+  return;
+}
+
+
+/**
+ * @brief Reduces the FSR scalar fluxes from private thread array to a
+ *        global array.
+ */
+void VectorizedPrivateSolver::reduceThreadScalarFluxes() {
+
+  #pragma omp parallel for schedule(guided)
+  for (int r=0; r < _num_FSRs; r++) {
+
+    FP_PRECISION* scalar_flux = &_scalar_flux(r,0);
+
+    for (int t=0; t < _num_threads; t++) {
+
+      FP_PRECISION* thread_flux = &_thread_flux(t,r,0);
+
+      /* Loop over each energy group vector length */
+      for (int v=0; v < _num_vector_lengths; v++) {
+
+        /* Loop over energy groups within this vector */
+        #pragma omp simd
+        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+          scalar_flux[e] += thread_flux[e];
+      }
+    }
+  }
+
+  return;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file VectorizedPrivateSolver.h
+ * @brief The VectorizedPrivateSolver class.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+
+#ifndef VECTORIZEDPRIVATESOLVER_H_
+#define VECTORIZEDPRIVATESOLVER_H_
+
+#ifdef __cplusplus
+#include "VectorizedSolver.h"
+#endif
+
+/** Indexing macro for the thread private FSR scalar fluxes */
+#define _thread_flux(t,r,e) (_thread_flux[(long)(t)*_num_FSRs*_num_groups \
+                                          + (long)(r)*_num_groups + (e)])
+
+
+/**
+ * @class VectorizedPrivateSolver VectorizedPrivateSolver.h
+ *        "src/VectorizedPrivateSolver.h"
+ * @brief This is a subclass of the VectorizedSolver class which uses thread
+ *        private arrays for the FSR scalar fluxes to minimize OMP atomics.
+ * @details Since this class stores a separate copy of the FSR scalar
+ *          fluxes for each OMP thread, the memory requirements are greater
+ *          than for the VectorizedSolver. The thread private copies are
+ *          reduced in parallel at the end of each transport sweep.
+ * @note This class is compiled with both the GNU and Intel compilers and is
+ *       available in the "openmoc.gnu.single", "openmoc.gnu.double",
+ *       "openmoc.intel.single" and "openmoc.intel.double" Python modules.
+ */
+class VectorizedPrivateSolver : public VectorizedSolver {
+
+protected:
+
+  /** An array for the FSR scalar fluxes for each thread */
+  FP_PRECISION* _thread_flux;
+
+  void initializeFluxArrays();
+
+  void flattenThreadFluxes(FP_PRECISION value);
+  void scalarFluxTally(int segment_id, int azim_index,
+                       FP_PRECISION* track_flux, FP_PRECISION* fsr_flux,
+                       bool fwd);
+  void reduceThreadScalarFluxes();
+  void transportSweep();
+
+public:
+  VectorizedPrivateSolver(Geometry* geometry=NULL,
+                          TrackGenerator* track_generator=NULL);
+  virtual ~VectorizedPrivateSolver();
+};
+
+
+#endif /* VECTORIZEDPRIVATESOLVER_H_ */
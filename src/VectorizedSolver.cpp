@@ -29,7 +29,11 @@ VectorizedSolver::VectorizedSolver(Geometry* geometry,
   if (track_generator != NULL)
     setTrackGenerator(track_generator);
 
-  vmlSetMode(VML_EP);
+  /* Select the exponential kernel for this processor's instruction set */
+  _vector_exp = vector_exp_function<FP_PRECISION>();
+
+  log_printf(INFO, "The VectorizedSolver will use the %s exponential kernel",
+             vector_exp_isa());
 }
 
 
@@ -39,16 +43,13 @@ VectorizedSolver::VectorizedSolver(Geometry* geometry,
  */
 VectorizedSolver::~VectorizedSolver() {
 
+  restoreBoundaryFluxBuffers();
+
   if (_boundary_flux != NULL) {
     MM_FREE(_boundary_flux);
     _boundary_flux = NULL;
   }
 
-  if (_boundary_leakage != NULL) {
-    MM_FREE(_boundary_leakage);
-    _boundary_leakage = NULL;
-  }
-
   if (_scalar_flux != NULL) {
     MM_FREE(_scalar_flux);
     _scalar_flux = NULL;
@@ -74,6 +75,11 @@ VectorizedSolver::~VectorizedSolver() {
     _reduced_sources = NULL;
   }
 
+  if (_FSR_rates != NULL) {
+    MM_FREE(_FSR_rates);
+    _FSR_rates = NULL;
+  }
+
   if (_delta_psi != NULL) {
     MM_FREE(_delta_psi);
     _delta_psi = NULL;
@@ -89,6 +95,10 @@ VectorizedSolver::~VectorizedSolver() {
     _thread_exponentials = NULL;
   }
 
+  if (_thread_fsr_flux != NULL) {
+    MM_FREE(_thread_fsr_flux);
+    _thread_fsr_flux = NULL;
+  }
 }
 
 
@@ -123,7 +133,7 @@ void VectorizedSolver::setGeometry(Geometry* geometry) {
 
   _polar_times_groups = _num_groups * _num_polar;
 
-  std::map<int, Material*> materials = geometry->getMaterials();
+  std::map<int, Material*> materials = geometry->getAllMaterials();
   std::map<int, Material*>::iterator iter;
 
   /* Iterate over each Material and replace its cross-section with a new one
@@ -163,13 +173,12 @@ void VectorizedSolver::buildExpInterpTable() {
  */
 void VectorizedSolver::initializeFluxArrays() {
 
+  restoreBoundaryFluxBuffers();
+
   /* Delete old flux arrays if they exist */
   if (_boundary_flux != NULL)
     MM_FREE(_boundary_flux);
 
-  if (_boundary_leakage != NULL)
-    MM_FREE(_boundary_leakage);
-
   if (_scalar_flux != NULL)
     MM_FREE(_scalar_flux);
 
@@ -179,21 +188,28 @@ void VectorizedSolver::initializeFluxArrays() {
   if (_thread_taus != NULL)
     MM_FREE(_thread_taus);
 
+  if (_thread_fsr_flux != NULL)
+    MM_FREE(_thread_fsr_flux);
+
   int size;
 
+  _boundary_flux = NULL;
+
   /* Allocate aligned memory for all flux arrays */
   try{
 
     size = 2 * _tot_num_tracks * _num_groups * _num_polar;
     size *= sizeof(FP_PRECISION);
-    _boundary_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
-    _boundary_leakage = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+
+    if (_boundary_flux_precision == BOUNDARY_FLUX_FULL)
+      _boundary_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 
     size = _num_FSRs * _num_groups * sizeof(FP_PRECISION);
     _scalar_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 
     size = _num_threads * _num_groups * sizeof(FP_PRECISION);
     _delta_psi = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+    _thread_fsr_flux = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
 
     size = _num_threads * _polar_times_groups * sizeof(FP_PRECISION);
     _thread_taus = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
@@ -228,6 +244,9 @@ void VectorizedSolver::initializeSourceArrays() {
   if (_source_residuals != NULL)
     MM_FREE(_source_residuals);
 
+  if (_FSR_rates != NULL)
+    MM_FREE(_FSR_rates);
+
   int size;
 
   /* Allocate aligned memory for all source arrays */
@@ -242,6 +261,9 @@ void VectorizedSolver::initializeSourceArrays() {
     size = _num_FSRs * sizeof(FP_PRECISION);
     _old_fission_sources = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
     _source_residuals = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
+
+    size = 3 * _num_FSRs * sizeof(FP_PRECISION);
+    _FSR_rates = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
   }
   catch(std::exception &e) {
     log_printf(ERROR, "Could not allocate memory for the VectorizedSolver's "
@@ -257,41 +279,41 @@ void VectorizedSolver::initializeSourceArrays() {
 void VectorizedSolver::normalizeFluxes() {
 
   FP_PRECISION* nu_sigma_f;
+  FP_PRECISION* scalar_flux;
+  FP_PRECISION* fission_sources;
   FP_PRECISION volume;
   FP_PRECISION tot_fission_source;
   FP_PRECISION norm_factor;
 
   /* Compute total fission source for each FSR, energy group */
-  #pragma omp parallel for private(volume, nu_sigma_f)  \
-    reduction(+:tot_fission_source) schedule(guided)
+  #pragma omp parallel for private(volume, nu_sigma_f, scalar_flux, \
+    fission_sources) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
 
     /* Get pointers to important data structures */
     nu_sigma_f = _FSR_materials[r]->getNuSigmaF();
+    scalar_flux = &_scalar_flux(r,0);
+    fission_sources = &_fission_sources(r,0);
     volume = _FSR_volumes[r];
 
     /* Loop over energy group vector lengths */
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over each energy group within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _fission_sources(r,e) = nu_sigma_f[e] * _scalar_flux(r,e);
+        fission_sources[e] = nu_sigma_f[e] * scalar_flux[e];
 
       /* Loop over each energy group within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _fission_sources(r,e) *= volume;
+        fission_sources[e] *= volume;
     }
   }
 
   /* Compute the total fission source */
   int size = _num_FSRs * _num_groups;
-  #ifdef SINGLE
-  tot_fission_source = cblas_sasum(size, _fission_sources, 1);
-  #else
-  tot_fission_source = cblas_dasum(size, _fission_sources, 1);
-  #endif
+  tot_fission_source = pairwise_sum<FP_PRECISION>(_fission_sources, size);
 
   /* Compute the normalization factor */
   norm_factor = 1.0 / tot_fission_source;
@@ -300,20 +322,25 @@ void VectorizedSolver::normalizeFluxes() {
              tot_fission_source, norm_factor);
 
   /* Normalize the FSR scalar fluxes */
-  #ifdef SINGLE
-  cblas_sscal(size, norm_factor, _scalar_flux, 1);
-  #else
-  cblas_dscal(size, norm_factor, _scalar_flux, 1);
-  #endif
+  scalar_flux = _scalar_flux;
+
+  #pragma omp parallel for simd schedule(static)
+  for (int i=0; i < size; i++)
+    scalar_flux[i] *= norm_factor;
+
+  /* Packed boundary fluxes are normalized through their scale */
+  if (_boundary_flux_precision != BOUNDARY_FLUX_FULL) {
+    _boundary_flux_scale *= norm_factor;
+    return;
+  }
 
   /* Normalize the Track angular boundary fluxes */
+  FP_PRECISION* boundary_flux = _boundary_flux;
   size = 2 * _tot_num_tracks * _num_polar * _num_groups;
 
-  #ifdef SINGLE
-  cblas_sscal(size, norm_factor, _boundary_flux, 1);
-  #else
-  cblas_dscal(size, norm_factor, _boundary_flux, 1);
-  #endif
+  #pragma omp parallel for simd schedule(static)
+  for (int i=0; i < size; i++)
+    boundary_flux[i] *= norm_factor;
 
   return;
 }
@@ -333,7 +360,6 @@ void VectorizedSolver::normalizeFluxes() {
  */
 FP_PRECISION VectorizedSolver::computeFSRSources() {
 
-  int tid;
   FP_PRECISION scatter_source;
   FP_PRECISION fission_source;
   FP_PRECISION fsr_fission_source;
@@ -341,6 +367,8 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
   FP_PRECISION* sigma_s;
   FP_PRECISION* sigma_t;
   FP_PRECISION* chi;
+  FP_PRECISION* scalar_flux;
+  FP_PRECISION* fission_sources;
   Material* material;
 
   FP_PRECISION source_residual = 0.0;
@@ -349,12 +377,13 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
 
   /* For all FSRs, find the source */
   #pragma omp parallel for private(material, nu_sigma_f, chi, \
-    sigma_s, sigma_t, fission_source, scatter_source, fsr_fission_source) \
-    schedule(guided)
+    sigma_s, sigma_t, fission_source, scatter_source, fsr_fission_source, \
+    scalar_flux, fission_sources) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
 
-    tid = omp_get_thread_num();
     material = _FSR_materials[r];
+    scalar_flux = &_scalar_flux(r,0);
+    fission_sources = &_fission_sources(r,0);
     nu_sigma_f = material->getNuSigmaF();
     chi = material->getChi();
     sigma_s = material->getSigmaS();
@@ -366,19 +395,19 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
 
     /* Compute fission source for each group */
     if (material->isFissionable()) {
+      fission_source = 0.0;
+
       for (int v=0; v < _num_vector_lengths; v++) {
 
         /* Compute fission source for each group */
-        #pragma simd vectorlength(VEC_LENGTH)
+        #pragma omp simd
         for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          _fission_sources(r,e) = _scalar_flux(r,e) * nu_sigma_f[e];
-      }
+          fission_sources[e] = scalar_flux[e] * nu_sigma_f[e];
 
-      #ifdef SINGLE
-      fission_source = cblas_sasum(_num_groups, &_fission_sources(r,0),1);
-      #else
-      fission_source = cblas_dasum(_num_groups, &_fission_sources(r,0),1);
-      #endif
+        #pragma omp simd reduction(+:fission_source)
+        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
+          fission_source += fission_sources[e];
+      }
 
       fission_source *= inverse_k_eff;
     }
@@ -392,18 +421,11 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
 
       for (int v=0; v < _num_vector_lengths; v++) {
 
-        #pragma simd vectorlength(VEC_LENGTH)
+        #pragma omp simd reduction(+:scatter_source)
         for (int g=v*VEC_LENGTH; g < (v+1)*VEC_LENGTH; g++)
-          _scatter_sources(tid,g) = sigma_s[G*_num_groups+g] *
-                                     _scalar_flux(r,g);
+          scatter_source += sigma_s[G*_num_groups+g] * scalar_flux[g];
       }
 
-      #ifdef SINGLE
-      scatter_source=cblas_sasum(_num_groups,&_scatter_sources(tid,0),1);
-      #else
-      scatter_source=cblas_dasum(_num_groups,&_scatter_sources(tid,0),1);
-      #endif
-
       /* Set the total source for FSR r in group G */
       fsr_fission_source += fission_source * chi[G];
 
@@ -421,11 +443,7 @@ FP_PRECISION VectorizedSolver::computeFSRSources() {
   }
 
   /* Sum up the residuals from each group and in each FSR */
-  #ifdef SINGLE
-  source_residual = cblas_sasum(_num_FSRs,_source_residuals,1);
-  #else
-  source_residual = cblas_dasum(_num_FSRs,_source_residuals,1);
-  #endif
+  source_residual = pairwise_sum<FP_PRECISION>(_source_residuals, _num_FSRs);
 
   source_residual = sqrt(source_residual \
                          / (_num_fissionable_FSRs * _num_groups));
@@ -443,32 +461,37 @@ void VectorizedSolver::addSourceToScalarFlux() {
 
   FP_PRECISION volume;
   FP_PRECISION* sigma_t;
+  FP_PRECISION* scalar_flux;
+  FP_PRECISION* reduced_sources;
 
   /* Add in source term and normalize flux to volume for each FSR */
   /* Loop over FSRs, energy groups */
-  #pragma omp parallel for private(volume, sigma_t) schedule(guided)
+  #pragma omp parallel for private(volume, sigma_t, scalar_flux, \
+    reduced_sources) schedule(guided)
   for (int r=0; r < _num_FSRs; r++) {
 
     volume = _FSR_volumes[r];
     sigma_t = _FSR_materials[r]->getSigmaT();
+    scalar_flux = &_scalar_flux(r,0);
+    reduced_sources = &_reduced_sources(r,0);
 
     /* Loop over each energy group vector length */
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _scalar_flux(r,e) *= 0.5;
+        scalar_flux[e] *= 0.5;
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _scalar_flux(r,e) = _scalar_flux(r,e) / (sigma_t[e] * volume);
+        scalar_flux[e] = scalar_flux[e] / (sigma_t[e] * volume);
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        _scalar_flux(r,e) += FOUR_PI * _reduced_sources(r,e);
+        scalar_flux[e] += FOUR_PI * reduced_sources[e];
     }
   }
 
@@ -489,143 +512,77 @@ void VectorizedSolver::addSourceToScalarFlux() {
  */
 void VectorizedSolver::computeKeff() {
 
-  int tid;
+  int r;
+  int material_index;
   Material* material;
-  FP_PRECISION* sigma;
+  FP_PRECISION* sigma_t;
+  FP_PRECISION* nu_sigma_f;
+  FP_PRECISION* scatter_totals;
+  FP_PRECISION* scalar_flux;
   FP_PRECISION volume;
+  FP_PRECISION total_rate;
+  FP_PRECISION fission_rate;
+  FP_PRECISION scatter_rate;
+
+  FP_PRECISION* total_rates = _FSR_rates;
+  FP_PRECISION* fission_rates = &_FSR_rates[_num_FSRs];
+  FP_PRECISION* scatter_rates = &_FSR_rates[2*_num_FSRs];
+
+  /* Loop over all batches of FSRs sharing a Material and compute the
+   * volume-weighted total, fission and scattering rates in one pass */
+  #pragma omp parallel for private(r, material_index, material, sigma_t, \
+    nu_sigma_f, scatter_totals, scalar_flux, volume, total_rate, \
+    fission_rate, scatter_rate) schedule(guided)
+  for (int b=0; b < _num_source_batches; b++) {
+
+    material_index = _source_batch_materials[b];
+    material = _source_materials[material_index];
+    sigma_t = material->getSigmaT();
+    nu_sigma_f = material->getNuSigmaF();
+    scatter_totals = &_scatter_totals(material_index,0);
 
-  FP_PRECISION total = 0.0;
-  FP_PRECISION fission = 0.0;
-  FP_PRECISION scatter = 0.0;
-
-  int size = _num_FSRs * sizeof(FP_PRECISION);
-  FP_PRECISION* FSR_rates = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
-
-  size = _num_threads * _num_groups * sizeof(FP_PRECISION);
-  FP_PRECISION* group_rates = (FP_PRECISION*)MM_MALLOC(size, VEC_ALIGNMENT);
-
-  /* Loop over all FSRs and compute the volume-weighted total rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, sigma) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    sigma = material->getSigmaT();
-
-    /* Loop over each energy group vector length */
-    for (int v=0; v < _num_vector_lengths; v++) {
-
-      /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        group_rates[tid+e] = sigma[e] * _scalar_flux(r,e);
-    }
-
-    #ifdef SINGLE
-    FSR_rates[r] = cblas_sasum(_num_groups, &group_rates[tid], 1) * volume;
-    #else
-    FSR_rates[r] = cblas_dasum(_num_groups, &group_rates[tid], 1) * volume;
-    #endif
-  }
-
-  /* Reduce total rates across FSRs, energy groups */
-  #ifdef SINGLE
-  total = cblas_sasum(_num_FSRs, FSR_rates, 1);
-  #else
-  tototal = cblas_dasum(_num_FSRs, FSR_rates, 1);
-  #endif
-
-  /* Loop over all FSRs and compute the volume-weighted fission rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, sigma) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    sigma = material->getNuSigmaF();
-
-    /* Loop over each energy group vector length */
-    for (int v=0; v < _num_vector_lengths; v++) {
-
-      /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        group_rates[tid+e] = sigma[e] * _scalar_flux(r,e);
-    }
-
-    #ifdef SINGLE
-    FSR_rates[r] = cblas_sasum(_num_groups, &group_rates[tid], 1) * volume;
-    #else
-    FSR_rates[r] = cblas_dasum(_num_groups, &group_rates[tid], 1) * volume;
-    #endif
-  }
-
-  /* Reduce fission rates across FSRs */
-  #ifdef SINGLE
-  fission = cblas_sasum(_num_FSRs, FSR_rates, 1);
-  #else
-  fission = cblas_dasum(_num_FSRs, FSR_rates, 1);
-  #endif
-
-  /* Loop over all FSRs and compute the volume-weighted scatter rates */
-  #pragma omp parallel for private(tid, volume, \
-    material, sigma) schedule(guided)
-  for (int r=0; r < _num_FSRs; r++) {
-
-    tid = omp_get_thread_num() * _num_groups;
-    volume = _FSR_volumes[r];
-    material = _FSR_materials[r];
-    sigma = material->getSigmaS();
+    for (int i=_source_batch_offsets[b]; i < _source_batch_offsets[b+1]; i++) {
 
-    FSR_rates[r] = 0.;
-
-    for (int G=0; G < _num_groups; G++) {
+      r = _source_batch_FSRs[i];
+      volume = _FSR_volumes[r];
+      scalar_flux = &_scalar_flux(r,0);
+      total_rate = 0.;
+      fission_rate = 0.;
+      scatter_rate = 0.;
 
       /* Loop over each energy group vector length */
       for (int v=0; v < _num_vector_lengths; v++) {
 
         /* Loop over energy groups within this vector */
-        #pragma simd vectorlength(VEC_LENGTH)
-        for (int g=v*VEC_LENGTH; g < (v+1)*VEC_LENGTH; g++)
-          group_rates[tid+g] = sigma[G*_num_groups+g] * _scalar_flux(r,g);
+        #pragma omp simd reduction(+:total_rate,fission_rate,scatter_rate)
+        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++) {
+          total_rate += sigma_t[e] * scalar_flux[e];
+          fission_rate += nu_sigma_f[e] * scalar_flux[e];
+          scatter_rate += scatter_totals[e] * scalar_flux[e];
+        }
       }
 
-      #ifdef SINGLE
-      FSR_rates[r] += cblas_sasum(_num_groups, &group_rates[tid], 1) * volume;
-      #else
-      FSR_rates[r] += cblas_dasum(_num_groups, &group_rates[tid], 1) * volume;
-      #endif
+      total_rates[r] = total_rate * volume;
+      fission_rates[r] = fission_rate * volume;
+      scatter_rates[r] = scatter_rate * volume;
     }
   }
 
-  /* Reduce scatter rates across FSRs */
-  #ifdef SINGLE
-  scatter = cblas_sasum(_num_FSRs, FSR_rates, 1);
-  #else
-  scatter = cblas_dasum(_num_FSRs, FSR_rates, 1);
-  #endif
+  /* Reduce the rates across FSRs in a fixed order independent of the
+   * number of threads */
+  FP_PRECISION total = pairwise_sum<FP_PRECISION>(total_rates, _num_FSRs);
+  FP_PRECISION fission = pairwise_sum<FP_PRECISION>(fission_rates, _num_FSRs);
+  FP_PRECISION scatter = pairwise_sum<FP_PRECISION>(scatter_rates, _num_FSRs);
 
-  /** Reduce leakage array across tracks, energy groups, polar angles */
-  size = 2 * _tot_num_tracks * _polar_times_groups;
-
-  #ifdef SINGLE
-  _leakage = cblas_sasum(size, _boundary_leakage, 1) * 0.5;
-  #else
-  _leakage = cblas_dasum(size, _boundary_leakage, 1) * 0.5;
-  #endif
+  /* Reduce the leakage tallied through vacuum boundaries */
+  _leakage = computeLeakage();
 
   _k_eff = fission / (total - scatter + _leakage);
 
   log_printf(DEBUG, "tot = %f, fiss = %f, scatt = %f, leakage = %f,"
              "k_eff = %f", total, fission, scatter, _leakage, _k_eff);
 
-  MM_FREE(FSR_rates);
-  MM_FREE(group_rates);
-
-return;
+  return;
 }
 
 
@@ -635,26 +592,35 @@ return;
  * @details This method integrates the angular flux for a Track segment across
  *        energy groups and polar angles, and tallies it into the FSR scalar
  *        flux, and updates the Track's angular flux.
- * @param curr_segment a pointer to the Track segment of interest
+ * @param segment_id the index of the segment in the flat segment arrays
  * @param azim_index a pointer to the azimuthal angle index for this segment
  * @param track_flux a pointer to the Track's angular flux
  * @param fsr_flux a pointer to the temporary FSR flux buffer
  * @param fwd
  */
-void VectorizedSolver::scalarFluxTally(segment* curr_segment,
+void VectorizedSolver::scalarFluxTally(int segment_id,
                                        int azim_index,
                                        FP_PRECISION* track_flux,
                                        FP_PRECISION* fsr_flux,
                                        bool fwd){
 
   int tid = omp_get_thread_num();
-  int fsr_id = curr_segment->_region_id;
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  int fsr_id = _segment_fsr_ids[segment_id];
   FP_PRECISION* delta_psi = &_delta_psi[tid*_num_groups];
-  FP_PRECISION* exponentials = &_thread_exponentials[tid*_polar_times_groups];
-
-  computeExponentials(curr_segment, exponentials);
+  FP_PRECISION* reduced_sources = &_reduced_sources(fsr_id,0);
+  FP_PRECISION* scalar_flux = &_scalar_flux(fsr_id,0);
+  FP_PRECISION* exponentials;
+  FP_PRECISION* polar_flux;
+  FP_PRECISION* polar_exponentials;
+  FP_PRECISION weight;
+
+  /* Use the stored exponentials if they were precomputed */
+  if (_exponentials != NULL)
+    exponentials = &_exponentials[(long)segment_id*_polar_times_groups];
+  else {
+    exponentials = &_thread_exponentials[tid*_polar_times_groups];
+    computeExponentials(segment_id, exponentials);
+  }
 
   /* Set the FSR scalar flux buffer to zero */
   memset(fsr_flux, 0.0, _num_groups * sizeof(FP_PRECISION));
@@ -663,43 +629,58 @@ void VectorizedSolver::scalarFluxTally(segment* curr_segment,
   /* Loop over polar angles */
   for (int p=0; p < _num_polar; p++){
 
+    polar_flux = &track_flux(p,0);
+    polar_exponentials = &exponentials(p,0);
+    weight = _polar_weights(azim_index,p);
+
     /* Loop over each energy group vector length */
     for (int v=0; v < _num_vector_lengths; v++) {
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        delta_psi[e] = track_flux(p,e) - _reduced_sources(fsr_id,e);
+        delta_psi[e] = polar_flux[e] - reduced_sources[e];
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        delta_psi[e] *= exponentials(p,e);
+        delta_psi[e] *= polar_exponentials[e];
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        fsr_flux[e] += delta_psi[e] * _polar_weights(azim_index,p);
+        fsr_flux[e] += delta_psi[e] * weight;
 
       /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
+      #pragma omp simd
       for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        track_flux(p,e) -= delta_psi[e];
+        polar_flux[e] -= delta_psi[e];
     }
   }
 
+  /* Store the FSR scalar flux for the reproducible reduction */
+  if (_flux_update_type == FLUX_UPDATE_REPRODUCIBLE)
+    memcpy(&_segment_fluxes(2L*segment_id + !fwd,0), fsr_flux,
+           _num_groups * sizeof(FP_PRECISION));
+
   /* Atomically increment the FSR scalar flux from the temporary array */
-  omp_set_lock(&_FSR_locks[fsr_id]);
-  {
-    #ifdef SINGLE
-    vsAdd(_num_groups, &_scalar_flux(fsr_id,0), fsr_flux,
-          &_scalar_flux(fsr_id,0));
-    #else
-    vdAdd(_num_groups, &_scalar_flux(fsr_id,0), fsr_flux,
-          &_scalar_flux(fsr_id,0));
-    #endif
+  else if (_flux_update_type == FLUX_UPDATE_ATOMIC) {
+    for (int e=0; e < _num_groups; e++) {
+      #pragma omp atomic
+      scalar_flux[e] += fsr_flux[e];
+    }
+  }
+  else {
+    int num_groups = _num_groups;
+
+    omp_set_lock(&_FSR_locks[fsr_id]);
+    {
+      #pragma omp simd
+      for (int e=0; e < num_groups; e++)
+        scalar_flux[e] += fsr_flux[e];
+    }
+    omp_unset_lock(&_FSR_locks[fsr_id]);
   }
-  omp_unset_lock(&_FSR_locks[fsr_id]);
 
   return;
 }
@@ -709,71 +690,64 @@ void VectorizedSolver::scalarFluxTally(segment* curr_segment,
  * @brief Computes an array of the exponentials in the transport equation,
  *        \f$ exp(-\frac{\Sigma_t * l}{sin(\theta)}) \f$, for each energy group
  *        and polar angle for a given Track segment.
- * @param curr_segment pointer to the Track segment of interest
+ * @param segment_id the index of the segment in the flat segment arrays
  * @param exponentials the array to store the exponential values
  */
-void VectorizedSolver::computeExponentials(segment* curr_segment,
+void VectorizedSolver::computeExponentials(int segment_id,
                                            FP_PRECISION* exponentials) {
 
-  FP_PRECISION length = curr_segment->_length;
-  FP_PRECISION* sigma_t = curr_segment->_material->getSigmaT();
+  FP_PRECISION length = _segment_lengths[segment_id];
+  FP_PRECISION* sigma_t =
+      _segment_sigma_t[_segment_material_indices[segment_id]];
 
   /* Evaluate the exponentials using the linear interpolation table */
-  if (_interpolate_exponential) {
-    FP_PRECISION tau;
-    int index;
-
-    for (int e=0; e < _num_groups; e++) {
-      for (int p=0; p < _num_polar; p++) {
-        tau = sigma_t[e] * length;
-        index = round_to_int(tau * _inverse_exp_table_spacing);
-        index *= _two_times_num_polar;
-        exponentials(p,e) = (1. - (_exp_table[index+2 * p] * tau +
-                             _exp_table[index + 2 * p +1]));
-      }
-    }
-  }
+  if (_interpolate_exponential)
+    CPUSolver::computeExponentials(segment_id, exponentials);
 
-  /* Evalute the exponentials using the intrinsic exp(...) function */
+  /* Evalute the exponentials using the intrinsic exp(...) function or the
+   * rational approximation */
   else {
 
     int tid = omp_get_thread_num();
 
     FP_PRECISION* sinthetas = _quad->getSinThetas();
     FP_PRECISION* taus = &_thread_taus[tid*_polar_times_groups];
+    FP_PRECISION* polar_taus;
+    FP_PRECISION inverse_sintheta;
+    int size = _polar_times_groups;
+
+    /* The rational approximation takes the positive optical length while
+     * the exponential kernel takes its negative */
+    FP_PRECISION sign = (_rational_exponential) ? 1.0 : -1.0;
 
     /* Initialize the tau argument for the exponentials */
     for (int p=0; p < _num_polar; p++) {
 
-      for (int v=0; v < _num_vector_lengths; v++) {
+      polar_taus = &taus(p,0);
+      inverse_sintheta = sign / sinthetas[p];
 
-        #pragma simd vectorlength(VEC_LENGTH)
-        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          taus(p,e) = -sigma_t[e] * length;
+      for (int v=0; v < _num_vector_lengths; v++) {
 
-        #pragma simd vectorlength(VEC_LENGTH)
+        #pragma omp simd
         for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          taus(p,e) /= sinthetas[p];
+          polar_taus[e] = sigma_t[e] * length * inverse_sintheta;
       }
     }
 
-    /* Evaluate the negative of the exponentials using Intel's MKL */
-    #ifdef SINGLE
-    vsExp(_polar_times_groups, taus, exponentials);
-    #else
-    vdExp(_polar_times_groups, taus, exponentials);
-    #endif
-
-    /* Compute one minus the exponentials */
-    for (int p=0; p < _num_polar; p++) {
+    /* Evaluate the exponentials using the rational approximation */
+    if (_rational_exponential) {
+      rational_exponentials(size, taus, exponentials);
+      return;
+    }
 
-      for (int v=0; v < _num_vector_lengths; v++) {
+    /* Evaluate the negative of the exponentials using the vectorized
+     * kernel selected for this processor */
+    _vector_exp(size, taus, exponentials);
 
-        #pragma simd vectorlength(VEC_LENGTH)
-        for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-          exponentials(p,e) = 1.0 - exponentials(p,e);
-      }
-    }
+    /* Compute one minus the exponentials */
+    #pragma omp simd
+    for (int i=0; i < size; i++)
+      exponentials[i] = 1.0 - exponentials[i];
   }
 }
 
@@ -793,16 +767,14 @@ void VectorizedSolver::transferBoundaryFlux(int track_id, int azim_index,
                                             FP_PRECISION* track_flux) {
   int start;
   bool bc;
-  FP_PRECISION* track_leakage;
   int track_out_id;
 
   /* Extract boundary conditions for this Track and the pointer to the
-   * outgoing reflective Track, and index into the leakage array */
+   * outgoing reflective Track */
 
   /* For the "forward" direction */
   if (direction) {
     start = _tracks[track_id]->isReflOut() * _polar_times_groups;
-    track_leakage = &_boundary_leakage(track_id,0);
     track_out_id = _tracks[track_id]->getTrackOut()->getUid();
     bc = _tracks[track_id]->getBCOut();
   }
@@ -810,33 +782,19 @@ void VectorizedSolver::transferBoundaryFlux(int track_id, int azim_index,
   /* For the "reverse" direction */
   else {
     start = _tracks[track_id]->isReflIn() * _polar_times_groups;
-    track_leakage = &_boundary_leakage(track_id,_polar_times_groups);
     track_out_id = _tracks[track_id]->getTrackIn()->getUid();
     bc = _tracks[track_id]->getBCIn();
   }
 
+  /* Tally the outgoing flux through a vacuum boundary as leakage */
+  if (!bc)
+    tallyLeakage(track_id, azim_index, direction, track_flux);
+
   FP_PRECISION* track_out_flux = &_boundary_flux(track_out_id,0,0,start);
+  FP_PRECISION reflect = bc;
 
   /* Loop over polar angles and energy groups */
-  for (int p=0; p < _num_polar; p++) {
-
-    /* Loop over each energy group vector length */
-    for (int v=0; v < _num_vector_lengths; v++) {
-
-      /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        track_out_flux(p,e) = track_flux(p,e) * bc;
-
-      /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        track_leakage(p,e) = track_flux(p,e);
-
-      /* Loop over energy groups within this vector */
-      #pragma simd vectorlength(VEC_LENGTH)
-      for (int e=v*VEC_LENGTH; e < (v+1)*VEC_LENGTH; e++)
-        track_leakage(p,e) *= _polar_weights(azim_index,p) * (!bc);
-    }
-  }
+  #pragma omp simd
+  for (int i=0; i < _polar_times_groups; i++)
+    track_out_flux[i] = track_flux[i] * reflect;
 }
@@ -14,8 +14,8 @@
 #include <math.h>
 #include <omp.h>
 #include <stdlib.h>
-#include <mkl.h>
 #include "CPUSolver.h"
+#include "vector_exp.h"
 #endif
 
 /** Indexing scheme for the optical length (\f$ l\Sigma_t \f$) for a
@@ -30,11 +30,13 @@
 /**
  * @class VectorizedSolver VectorizedSolver.h "src/VectorizedSolver.h"
  * @brief This is a subclass of the CPUSolver class which uses memory-aligned
- *        data structures and Intel's auto-vectorization.
- * @note This class is only compiled if the Intel compiler is used when building
- *       OpenMOC. If building OpenMOC with the "--with-icpc" flag, then this
- *       class will be available in the "openmoc.intel.single" or
- *       "openmoc.intel.double" Python module.
+ *        data structures and OpenMP SIMD vectorization.
+ * @details The energy group loops are vectorized with OpenMP SIMD directives
+ *          and the exponentials are evaluated with the vectorized kernel
+ *          from vector_exp.h which is best suited to the processor.
+ * @note This class is compiled with both the GNU and Intel compilers and is
+ *       available in the "openmoc.gnu.single", "openmoc.gnu.double",
+ *       "openmoc.intel.single" and "openmoc.intel.double" Python modules.
  */
 class VectorizedSolver : public CPUSolver {
 
@@ -53,13 +55,16 @@ protected:
    *  each thread in each energy group and polar angle */
   FP_PRECISION* _thread_exponentials;
 
+  /** The vectorized exponential kernel selected for this processor */
+  void (*_vector_exp)(int n, const FP_PRECISION* x, FP_PRECISION* y);
+
   void buildExpInterpTable();
   void initializeFluxArrays();
   void initializeSourceArrays();
 
   void normalizeFluxes();
   FP_PRECISION computeFSRSources();
-  void scalarFluxTally(segment* curr_segment, int azim_index,
+  void scalarFluxTally(int segment_id, int azim_index,
                        FP_PRECISION* track_flux,
                        FP_PRECISION* fsr_flux, bool fwd);
   void transferBoundaryFlux(int track_id, int azim_index, bool direction,
@@ -72,10 +77,10 @@ protected:
    * @brief Computes an array of the exponentials in the transport equation,
    *        \f$ exp(-\frac{\Sigma_t * l}{sin(\theta)}) \f$, for each
    *        energy group and polar angle for a given segment.
-   * @param curr_segment pointer to the segment of interest
+   * @param segment_id the index of the segment in the flat segment arrays
    * @param exponentials the array to store the exponential values
    */
-  virtual void computeExponentials(segment* curr_segment,
+  virtual void computeExponentials(int segment_id,
                                    FP_PRECISION* exponentials);
 
 public:
@@ -720,6 +720,7 @@ GPUSolver::GPUSolver(Geometry* geometry, TrackGenerator* track_generator) :
   _fission = NULL;
   _scatter = NULL;
   _leakage = NULL;
+  _exp_table = NULL;
 
   if (geometry != NULL)
     setGeometry(geometry);
@@ -1124,10 +1125,7 @@ void GPUSolver::initializeFSRs() {
     /* Initialize each FSRs volume to 0 to avoid NaNs */
     memset(temp_FSR_volumes, FP_PRECISION(0.), _num_FSRs*sizeof(FP_PRECISION));
 
-    Track* track;
-    int num_segments;
-    segment* curr_segment;
-    segment* segments;
+    int uid;
     FP_PRECISION volume;
 
     FP_PRECISION* azim_weights = _track_generator->getAzimWeights();
@@ -1137,15 +1135,12 @@ void GPUSolver::initializeFSRs() {
     for (int i=0; i < _num_azim; i++) {
       for (int j=0; j < _num_tracks[i]; j++) {
 
-        track = &_track_generator->getTracks()[i][j];
-        num_segments = track->getNumSegments();
-        segments = track->getSegments();
+        uid = _track_generator->getTracks()[i][j].getUid();
 
         /* Iterate over the Track's segments to update FSR volumes */
-        for (int s = 0; s < num_segments; s++) {
-          curr_segment = &segments[s];
-          volume = curr_segment->_length * azim_weights[i];
-          temp_FSR_volumes[curr_segment->_region_id] += volume;
+        for (int s=_segment_offsets[uid]; s < _segment_offsets[uid+1]; s++) {
+          volume = _segment_lengths[s] * azim_weights[i];
+          temp_FSR_volumes[_segment_fsr_ids[s]] += volume;
         }
       }
     }
@@ -1237,7 +1232,13 @@ void GPUSolver::initializeTracks() {
 
     for (int i=0; i < _tot_num_tracks; i++) {
 
-      clone_track_on_gpu(_tracks[i], &_dev_tracks[i], _material_IDs_to_indices);
+      clone_track_on_gpu(_tracks[i], &_dev_tracks[i],
+                         _segment_offsets[i+1] - _segment_offsets[i],
+                         &_segment_lengths[_segment_offsets[i]],
+                         &_segment_fsr_ids[_segment_offsets[i]],
+                         &_segment_material_indices[_segment_offsets[i]],
+                         _track_generator->getSegmentMaterials(),
+                         _material_IDs_to_indices);
 
       /* Make Track reflective */
       index = computeScalarTrackIndex(_tracks[i]->getTrackInI(),
@@ -1452,6 +1453,10 @@ void GPUSolver::buildExpInterpTable(){
 
   log_printf(INFO, "Building exponential interpolation table on device...");
 
+  if (_rational_exponential)
+    log_printf(WARNING, "The GPUSolver does not support the rational "
+               "exponential approximation and will use the exp intrinsic");
+
   /* Copy a boolean indicating whether or not to use the linear interpolation
    * table or the exp intrinsic function */
   cudaMemcpyToSymbol(interpolate_exponential,(void*)&_interpolate_exponential,
@@ -1463,24 +1468,26 @@ void GPUSolver::buildExpInterpTable(){
                      _num_polar * sizeof(FP_PRECISION), 0,
                      cudaMemcpyHostToDevice);
 
-  /* Find largest optical path length track segment */
-  FP_PRECISION tau = _track_generator->getMaxOpticalLength();
+  /* The table is stored in FP_PRECISION and sized for the convergence
+   * threshold since the host's caches do not apply to the device */
+  if (_exp_table_cache_level != 0)
+    log_printf(WARNING, "The GPUSolver does not size the exponential table "
+               "for the L%d cache", _exp_table_cache_level);
 
-  /* Expand tau slightly to accomodate track segments which have a
-   * length very nearly equal to the maximum value */
-  tau *= 1.01;
+  if (_exp_table_precision != EXP_TABLE_SINGLE && isUsingSinglePrecision())
+    log_printf(WARNING, "The GPUSolver stores the exponential table in "
+               "single precision");
+  else if (_exp_table_precision != EXP_TABLE_DOUBLE &&
+           isUsingDoublePrecision())
+    log_printf(WARNING, "The GPUSolver stores the exponential table in "
+               "double precision");
 
   /* Set size of interpolation table */
-  int num_array_values =
-          tau * sqrt(1. / (8. * _source_convergence_thresh * 1e-2));
-  _exp_table_spacing = tau / num_array_values;
-  _inverse_exp_table_spacing = 1.0 / _exp_table_spacing;
-  _exp_table_size = _two_times_num_polar * num_array_values;
-  _exp_table_max_index = _exp_table_size - _two_times_num_polar - 1;
-
-  /* Allocate array for the table */
+  int num_array_values = initializeExpTableSpacing(sizeof(FP_PRECISION), 0);
+
+  /* Delete the old table on the device if it exists */
   if (_exp_table != NULL)
-    delete [] _exp_table;
+    cudaFree(_exp_table);
 
   FP_PRECISION* exp_table = new FP_PRECISION[_exp_table_size];
 
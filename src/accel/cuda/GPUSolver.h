@@ -86,6 +86,9 @@ private:
   /** A pointer to the Thrust vector of leakages for each Track */
   FP_PRECISION* _leakage;
 
+  /** The exponential linear interpolation table on the device */
+  FP_PRECISION* _exp_table;
+
   /** Thrust vector of fission sources in each FSR */
   thrust::device_vector<FP_PRECISION> _fission_sources_vec;
 
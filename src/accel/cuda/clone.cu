@@ -77,38 +77,49 @@ void clone_material_on_gpu(Material* material_h, dev_material* material_d) {
  *          directly.  
  * @param track_h pointer to a Track on the host
  * @param track_d pointer to a dev_track on the GPU
+ * @param num_segments the number of segments along the Track
+ * @param segment_lengths the Track's segment lengths in the TrackGenerator's
+ *        flat segment arrays
+ * @param segment_fsr_ids the Track's segment FSR IDs in the TrackGenerator's
+ *        flat segment arrays
+ * @param segment_material_indices the Track's segment Material indices in the
+ *        TrackGenerator's flat segment arrays
+ * @param segment_materials the TrackGenerator's compact array of Materials
  * @param material_IDs_to_indices map of material IDs to indices
  *        in the _materials array.
  */
-void clone_track_on_gpu(Track* track_h, dev_track* track_d, 
-     			std::map<int, int> &material_IDs_to_indices) {
+void clone_track_on_gpu(Track* track_h, dev_track* track_d,
+                        int num_segments, FP_PRECISION* segment_lengths,
+                        int* segment_fsr_ids, int* segment_material_indices,
+                        Material** segment_materials,
+                        std::map<int, int> &material_IDs_to_indices) {
 
   dev_segment* dev_segments;
-  dev_segment* host_segments = new dev_segment[track_h->getNumSegments()];
+  dev_segment* host_segments = new dev_segment[num_segments];
   dev_track new_track;
+  Material* material;
 
   new_track._uid = track_h->getUid();
-  new_track._num_segments = track_h->getNumSegments();
+  new_track._num_segments = num_segments;
   new_track._azim_angle_index = track_h->getAzimAngleIndex();
   new_track._refl_in = track_h->isReflIn();
   new_track._refl_out = track_h->isReflOut();
   new_track._bc_in = track_h->getBCIn();
   new_track._bc_out = track_h->getBCOut();
 
-  cudaMalloc((void**)&dev_segments,
-             track_h->getNumSegments() * sizeof(dev_segment));
+  cudaMalloc((void**)&dev_segments, num_segments * sizeof(dev_segment));
   new_track._segments = dev_segments;
 
-  for (int s=0; s < track_h->getNumSegments(); s++) {
-    segment* curr = track_h->getSegment(s);
-    host_segments[s]._length = curr->_length;
-    host_segments[s]._region_uid = curr->_region_id;
-    host_segments[s]._material_index = 
-      material_IDs_to_indices[curr->_material->getId()];
+  for (int s=0; s < num_segments; s++) {
+    material = segment_materials[segment_material_indices[s]];
+    host_segments[s]._length = segment_lengths[s];
+    host_segments[s]._region_uid = segment_fsr_ids[s];
+    host_segments[s]._material_index =
+      material_IDs_to_indices[material->getId()];
   }
 
   cudaMemcpy((void*)dev_segments, (void*)host_segments,
-             track_h->getNumSegments() * sizeof(dev_segment),
+             num_segments * sizeof(dev_segment),
              cudaMemcpyHostToDevice);
   cudaMemcpy((void*)track_d, (void*)&new_track, sizeof(dev_track),
              cudaMemcpyHostToDevice);
@@ -11,5 +11,8 @@
 #include <map>
 
 void clone_material_on_gpu(Material* material_h, dev_material* material_d);
-void clone_track_on_gpu(Track* track_h, dev_track* track_d, 
+void clone_track_on_gpu(Track* track_h, dev_track* track_d,
+                        int num_segments, FP_PRECISION* segment_lengths,
+                        int* segment_fsr_ids, int* segment_material_indices,
+                        Material** segment_materials,
                         std::map<int, int> &material_IDs_to_indices);
@@ -0,0 +1,187 @@
+/**
+ * @file exp_benchmark.cpp
+ * @brief Microbenchmark for the methods to evaluate the exponential term in
+ *        the transport equation.
+ * @details Evaluates \f$ 1 - exp(-\tau) \f$ for random optical lengths with
+ *          the linear interpolation table, the exp(...) intrinsic, the
+ *          vectorized exponential kernel and the rational approximation.
+ *          The maximum absolute and relative errors with respect to a long
+ *          double reference and the throughput of each method are reported.
+ *          The optical lengths are drawn log-uniformly from
+ *          \f$ [10^{-6}, \tau_{max}] \f$ to cover the thin segments in
+ *          moderator and thick segments in fuel. The benchmark is built with
+ *          "make exp_benchmark" and takes the maximum optical length, the
+ *          number of values and the number of repetitions as optional
+ *          arguments.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <omp.h>
+#include "vector_exp.h"
+#include "rational_exp.h"
+
+#ifndef FP_PRECISION
+#define FP_PRECISION double
+#endif
+
+
+/**
+ * @brief Evaluates the exponential term with a linear interpolation table
+ *        built as in CPUSolver::buildExpInterpTable() for a single polar
+ *        angle with \f$ sin(\theta) = 1 \f$.
+ * @param n the number of values
+ * @param tau the array of optical lengths
+ * @param y the array to store the exponential terms
+ * @param table the slopes and intercepts of the table
+ * @param inverse_spacing the inverse of the table entry spacing
+ */
+static void table_exponentials(int n, const FP_PRECISION* tau,
+                               FP_PRECISION* y, const FP_PRECISION* table,
+                               FP_PRECISION inverse_spacing) {
+
+  for (int i=0; i < n; i++) {
+    int index = 2 * (int)(tau[i] * inverse_spacing + 0.5);
+    y[i] = 1. - (table[index] * tau[i] + table[index+1]);
+  }
+}
+
+
+/**
+ * @brief Evaluates the exponential term with the exp(...) intrinsic.
+ * @param n the number of values
+ * @param tau the array of optical lengths
+ * @param y the array to store the exponential terms
+ */
+static void intrinsic_exponentials(int n, const FP_PRECISION* tau,
+                                   FP_PRECISION* y) {
+
+  for (int i=0; i < n; i++)
+    y[i] = 1.0 - exp(-tau[i]);
+}
+
+
+/**
+ * @brief Evaluates the exponential term with the vectorized exponential
+ *        kernel selected for this processor.
+ * @param n the number of values
+ * @param tau the array of optical lengths
+ * @param y the array to store the exponential terms
+ * @param work a work array for the negative optical lengths
+ */
+static void vector_exponentials(int n, const FP_PRECISION* tau,
+                                FP_PRECISION* y, FP_PRECISION* work) {
+
+  static void (*vector_exp)(int, const FP_PRECISION*, FP_PRECISION*) =
+      vector_exp_function<FP_PRECISION>();
+
+  #pragma omp simd
+  for (int i=0; i < n; i++)
+    work[i] = -tau[i];
+
+  vector_exp(n, work, y);
+
+  #pragma omp simd
+  for (int i=0; i < n; i++)
+    y[i] = 1.0 - y[i];
+}
+
+
+/**
+ * @brief Prints the errors and throughput for one exponential method.
+ * @param name the name of the method
+ * @param n the number of values
+ * @param tau the array of optical lengths
+ * @param y the array of exponential terms from the method
+ * @param seconds the time for all repetitions
+ * @param num_reps the number of repetitions
+ */
+static void report(const char* name, int n, const FP_PRECISION* tau,
+                   const FP_PRECISION* y, double seconds, int num_reps) {
+
+  long double max_abs_error = 0.;
+  long double max_rel_error = 0.;
+
+  for (int i=0; i < n; i++) {
+    long double exact = -expm1l(-(long double)tau[i]);
+    long double error = fabsl((long double)y[i] - exact);
+
+    if (error > max_abs_error)
+      max_abs_error = error;
+    if (error / exact > max_rel_error)
+      max_rel_error = error / exact;
+  }
+
+  printf("%-20s %12.3Le %12.3Le %12.1f\n", name, max_abs_error,
+         max_rel_error, (double)n * num_reps / seconds / 1.E6);
+}
+
+
+int main(int argc, char** argv) {
+
+  double max_tau = (argc > 1) ? atof(argv[1]) : 10.0;
+  int n = (argc > 2) ? atoi(argv[2]) : 4096;
+  int num_reps = (argc > 3) ? atoi(argv[3]) : 20000;
+
+  FP_PRECISION* tau = new FP_PRECISION[n];
+  FP_PRECISION* y = new FP_PRECISION[n];
+  FP_PRECISION* work = new FP_PRECISION[n];
+
+  /* Draw log-uniform optical lengths in [1E-6, max_tau] */
+  srand(1);
+  for (int i=0; i < n; i++) {
+    double r = (double)rand() / RAND_MAX;
+    tau[i] = 1.E-6 * pow(max_tau / 1.E-6, r);
+  }
+
+  /* Build the interpolation table as the Solver does for a source
+   * convergence threshold of 1E-5 */
+  int num_values = max_tau * 1.01 * sqrt(1. / (8. * 1.E-5 * 1.E-2));
+  FP_PRECISION spacing = max_tau * 1.01 / num_values;
+  FP_PRECISION* table = new FP_PRECISION[2 * num_values];
+
+  for (int i=0; i < num_values; i++) {
+    FP_PRECISION expon = exp(-i * spacing);
+    table[2*i] = -expon;
+    table[2*i+1] = expon * (1 + i * spacing);
+  }
+
+  printf("%d optical lengths in [1E-6, %g], %d repetitions, %s precision, "
+         "%s exp kernel\n", n, max_tau, num_reps,
+         (sizeof(FP_PRECISION) == sizeof(double)) ? "double" : "single",
+         vector_exp_isa());
+  printf("%-20s %12s %12s %12s\n", "method", "max abs err", "max rel err",
+         "Mexp/s");
+
+  double start;
+
+  start = omp_get_wtime();
+  for (int r=0; r < num_reps; r++)
+    table_exponentials(n, tau, y, table, 1. / spacing);
+  report("interpolation", n, tau, y, omp_get_wtime() - start, num_reps);
+
+  start = omp_get_wtime();
+  for (int r=0; r < num_reps; r++)
+    intrinsic_exponentials(n, tau, y);
+  report("intrinsic", n, tau, y, omp_get_wtime() - start, num_reps);
+
+  start = omp_get_wtime();
+  for (int r=0; r < num_reps; r++)
+    vector_exponentials(n, tau, y, work);
+  report("vector intrinsic", n, tau, y, omp_get_wtime() - start, num_reps);
+
+  start = omp_get_wtime();
+  for (int r=0; r < num_reps; r++)
+    rational_exponentials(n, tau, y);
+  report("rational", n, tau, y, omp_get_wtime() - start, num_reps);
+
+  delete [] tau;
+  delete [] y;
+  delete [] work;
+  delete [] table;
+
+  return 0;
+}
@@ -0,0 +1,142 @@
+/**
+ * @file half_precision.h
+ * @brief Conversions between single precision and 16-bit floating point
+ *        formats.
+ * @details The IEEE 754 half precision (FP16) format has a 10 bit mantissa
+ *          and a 5 bit exponent for a relative precision of
+ *          \f$ 4.9 \times 10^{-4} \f$ and a range of
+ *          \f$ [6.0 \times 10^{-8}, 65504] \f$. The bfloat16 (BF16) format
+ *          has a 7 bit mantissa and the 8 bit exponent of single precision
+ *          for a relative precision of \f$ 3.9 \times 10^{-3} \f$ over the
+ *          full single precision range. Both conversions from single
+ *          precision round to the nearest value with ties to even.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+#ifndef HALF_PRECISION_H_
+#define HALF_PRECISION_H_
+
+#include <string.h>
+#include <stdint.h>
+
+
+/**
+ * @brief Converts a single precision value to half precision.
+ * @details Values beyond the half precision range are converted to
+ *          infinity and values below half of the smallest subnormal are
+ *          converted to zero.
+ * @param value the single precision value
+ * @return the bits of the half precision value
+ */
+inline uint16_t float_to_fp16(float value) {
+
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(float));
+
+  uint32_t sign = (bits >> 16) & 0x8000;
+  uint32_t magnitude = bits & 0x7FFFFFFF;
+
+  /* Infinity and NaN */
+  if (magnitude >= 0x7F800000)
+    return sign | 0x7C00 | ((magnitude > 0x7F800000) ? 0x200 : 0);
+
+  /* Values which round beyond the largest half precision value (65504) */
+  if (magnitude >= 0x477FF000)
+    return sign | 0x7C00;
+
+  /* Subnormal half precision values */
+  if (magnitude < 0x38800000) {
+
+    if (magnitude < 0x33000000)
+      return sign;
+
+    uint32_t mantissa = (magnitude & 0x007FFFFF) | 0x00800000;
+    int shift = 126 - (magnitude >> 23);
+    uint32_t half = mantissa >> shift;
+    uint32_t remainder = mantissa & ((1u << shift) - 1);
+    uint32_t halfway = 1u << (shift - 1);
+
+    if (remainder > halfway || (remainder == halfway && (half & 1)))
+      half++;
+
+    return sign | half;
+  }
+
+  /* Normal half precision values with the exponent bias changed from 127
+   * to 15 and the mantissa rounded from 23 to 10 bits */
+  uint32_t half = (magnitude - 0x38000000) >> 13;
+  uint32_t remainder = magnitude & 0x1FFF;
+
+  if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1)))
+    half++;
+
+  return sign | half;
+}
+
+
+/**
+ * @brief Converts a half precision value to single precision.
+ * @param bits the bits of the half precision value
+ * @return the single precision value
+ */
+inline float fp16_to_float(uint16_t bits) {
+
+  uint32_t sign = (uint32_t)(bits & 0x8000) << 16;
+  uint32_t exponent = (bits >> 10) & 0x1F;
+  uint32_t mantissa = bits & 0x3FF;
+  uint32_t result;
+  float value;
+
+  /* Zero and subnormal values are exact multiples of 2^-24 */
+  if (exponent == 0) {
+    value = mantissa * 5.9604644775390625e-8f;
+    memcpy(&result, &value, sizeof(float));
+    result |= sign;
+  }
+
+  /* Infinity and NaN */
+  else if (exponent == 0x1F)
+    result = sign | 0x7F800000 | (mantissa << 13);
+
+  else
+    result = sign | ((exponent + 112) << 23) | (mantissa << 13);
+
+  memcpy(&value, &result, sizeof(float));
+  return value;
+}
+
+
+/**
+ * @brief Converts a single precision value to bfloat16.
+ * @param value the single precision value
+ * @return the bits of the bfloat16 value
+ */
+inline uint16_t float_to_bf16(float value) {
+
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(float));
+
+  /* Keep NaN quiet rather than rounding it to infinity */
+  if ((bits & 0x7FFFFFFF) > 0x7F800000)
+    return (bits >> 16) | 0x40;
+
+  bits += 0x7FFF + ((bits >> 16) & 1);
+  return bits >> 16;
+}
+
+
+/**
+ * @brief Converts a bfloat16 value to single precision.
+ * @param bits the bits of the bfloat16 value
+ * @return the single precision value
+ */
+inline float bf16_to_float(uint16_t bits) {
+
+  uint32_t result = (uint32_t)bits << 16;
+  float value;
+  memcpy(&value, &result, sizeof(float));
+  return value;
+}
+
+#endif /* HALF_PRECISION_H_ */
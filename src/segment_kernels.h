@@ -0,0 +1,101 @@
+/**
+ * @file segment_kernels.h
+ * @brief Track segment kernels specialized for the number of energy groups
+ *        and polar angles.
+ * @details The kernel for a Track segment attenuates the angular flux for
+ *          each polar angle and energy group and tallies the change into
+ *          the FSR scalar flux. The kernel is compiled for each of the
+ *          common numbers of energy groups (1, 2, 7 and 8) and polar angles
+ *          (1, 2 and 3) such that the compiler may fully unroll and
+ *          vectorize the loops. A generic kernel with the numbers of groups
+ *          and polar angles given at runtime is used for any other
+ *          problem. The kernel is selected once for each simulation.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+#ifndef SEGMENT_KERNELS_H_
+#define SEGMENT_KERNELS_H_
+
+
+/**
+ * @brief Attenuates the angular flux along a Track segment and tallies the
+ *        change into the FSR scalar flux.
+ * @details The template parameters give the number of energy groups and
+ *          polar angles at compile time, or zero to use the values given
+ *          at runtime. The angular fluxes and exponentials are indexed by
+ *          polar angle and then by energy group.
+ * @param num_groups the number of energy groups
+ * @param num_polar the number of polar angles
+ * @param track_flux the Track's angular flux for each polar angle and group
+ * @param sources the FSR's reduced source for each energy group
+ * @param exponentials the segment's exponentials for each polar angle and
+ *        energy group
+ * @param weights the polar weights for the Track's azimuthal angle
+ * @param fsr_flux the FSR scalar flux to increment for each energy group
+ */
+template <typename T, int NUM_GROUPS, int NUM_POLAR>
+void tally_segment(int num_groups, int num_polar, T* track_flux,
+                   const T* sources, const T* exponentials, const T* weights,
+                   T* fsr_flux) {
+
+  const int groups = (NUM_GROUPS > 0) ? NUM_GROUPS : num_groups;
+  const int polar = (NUM_POLAR > 0) ? NUM_POLAR : num_polar;
+
+  /* Loop over polar angles */
+  for (int p=0; p < polar; p++) {
+
+    T* polar_flux = &track_flux[p*groups];
+    const T* polar_exponentials = &exponentials[p*groups];
+    T weight = weights[p];
+
+    /* Loop over energy groups */
+    #pragma omp simd
+    for (int e=0; e < groups; e++) {
+      T delta_psi = (polar_flux[e] - sources[e]) * polar_exponentials[e];
+      fsr_flux[e] += delta_psi * weight;
+      polar_flux[e] -= delta_psi;
+    }
+  }
+}
+
+
+/**
+ * @brief Returns the Track segment kernel for a number of energy groups and
+ *        polar angles.
+ * @param num_groups the number of energy groups
+ * @param num_polar the number of polar angles
+ * @return a pointer to the specialized kernel if there is one, or to the
+ *         generic kernel otherwise
+ */
+template <typename T>
+void (*segment_kernel(int num_groups, int num_polar))
+     (int, int, T*, const T*, const T*, const T*, T*) {
+
+  typedef void (*kernel)(int, int, T*, const T*, const T*, const T*, T*);
+
+  /* The specialized kernels for each number of groups and polar angles */
+  static const kernel kernels[4][3] = {
+    {&tally_segment<T,1,1>, &tally_segment<T,1,2>, &tally_segment<T,1,3>},
+    {&tally_segment<T,2,1>, &tally_segment<T,2,2>, &tally_segment<T,2,3>},
+    {&tally_segment<T,7,1>, &tally_segment<T,7,2>, &tally_segment<T,7,3>},
+    {&tally_segment<T,8,1>, &tally_segment<T,8,2>, &tally_segment<T,8,3>}
+  };
+
+  int group_index;
+
+  switch (num_groups) {
+    case 1: group_index = 0; break;
+    case 2: group_index = 1; break;
+    case 7: group_index = 2; break;
+    case 8: group_index = 3; break;
+    default: return &tally_segment<T,0,0>;
+  }
+
+  if (num_polar < 1 || num_polar > 3)
+    return &tally_segment<T,0,0>;
+
+  return kernels[group_index][num_polar-1];
+}
+
+#endif /* SEGMENT_KERNELS_H_ */
@@ -0,0 +1,228 @@
+/**
+ * @file vector_exp.h
+ * @brief Portable vectorized exponential kernels with runtime dispatch.
+ * @details The kernels evaluate \f$ exp(x) \f$ for an array of arguments
+ *          using Cody-Waite range reduction and a polynomial approximation
+ *          which the compiler vectorizes through OpenMP SIMD directives. On
+ *          x86 processors with GNU compilers, AVX-512 and AVX2 versions of
+ *          the kernel are compiled alongside the default build and the best
+ *          one supported by the processor is selected at runtime. All other
+ *          processors use a scalar loop over the exp(...) intrinsic.
+ * @date October 17, 2026
+ * @author agent (agent@local)
+ */
+
+#ifndef VECTOR_EXP_H_
+#define VECTOR_EXP_H_
+
+#include <math.h>
+#include <string.h>
+#include <stdint.h>
+
+/* Runtime CPU dispatch is only supported by GNU compilers on x86 */
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_EXP_DISPATCH
+#endif
+
+#ifdef VECTOR_EXP_DISPATCH
+/** Forces the polynomial kernel to be inlined into each target version */
+#define VECTOR_EXP_INLINE inline __attribute__((always_inline))
+#else
+/** Forces the polynomial kernel to be inlined into each target version */
+#define VECTOR_EXP_INLINE inline
+#endif
+
+
+/**
+ * @brief Evaluates the exponential of an array of double precision values
+ *        with a degree 11 polynomial.
+ * @details The argument is reduced to \f$ x = k ln(2) + r \f$ with
+ *          \f$ |r| \leq ln(2)/2 \f$ such that \f$ exp(x) = 2^k exp(r) \f$.
+ *          The relative error is below \f$ 10^{-14} \f$ for arguments in
+ *          \f$ [-708, 709] \f$ which are clamped to this range.
+ * @param n the number of values
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+VECTOR_EXP_INLINE void vector_exp_polynomial(int n, const double* x,
+                                             double* y) {
+
+  #pragma omp simd
+  for (int i=0; i < n; i++) {
+
+    double t = x[i];
+    t = (t < -708.0) ? -708.0 : t;
+    t = (t > 709.0) ? 709.0 : t;
+
+    /* Round x / ln(2) to the nearest integer */
+    double u = t * 1.4426950408889634;
+    int k = (int)(u + ((u < 0.0) ? -0.5 : 0.5));
+    double r = t - k * 6.93147180369123816490e-01;
+    r = r - k * 1.90821492927058770002e-10;
+
+    /* Evaluate the Taylor series for exp(r) with Horner's scheme */
+    double p = 2.5052108385441720e-08;
+    p = p * r + 2.7557319223985893e-07;
+    p = p * r + 2.7557319223985888e-06;
+    p = p * r + 2.4801587301587302e-05;
+    p = p * r + 1.9841269841269841e-04;
+    p = p * r + 1.3888888888888889e-03;
+    p = p * r + 8.3333333333333333e-03;
+    p = p * r + 4.1666666666666667e-02;
+    p = p * r + 1.6666666666666667e-01;
+    p = p * r + 0.5;
+    p = p * r + 1.0;
+    p = p * r + 1.0;
+
+    /* Scale by 2^k by constructing the exponent bits directly */
+    int64_t bits = (int64_t)(k + 1023) << 52;
+    double scale;
+    memcpy(&scale, &bits, sizeof(double));
+    y[i] = p * scale;
+  }
+}
+
+
+/**
+ * @brief Evaluates the exponential of an array of single precision values
+ *        with a degree 7 polynomial.
+ * @details The argument is reduced to \f$ x = k ln(2) + r \f$ with
+ *          \f$ |r| \leq ln(2)/2 \f$ such that \f$ exp(x) = 2^k exp(r) \f$.
+ *          The relative error is below \f$ 2 \times 10^{-7} \f$ for
+ *          arguments in \f$ [-87, 88] \f$ which are clamped to this range.
+ * @param n the number of values
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+VECTOR_EXP_INLINE void vector_exp_polynomial(int n, const float* x,
+                                             float* y) {
+
+  #pragma omp simd
+  for (int i=0; i < n; i++) {
+
+    float t = x[i];
+    t = (t < -87.f) ? -87.f : t;
+    t = (t > 88.f) ? 88.f : t;
+
+    /* Round x / ln(2) to the nearest integer and reduce the argument in
+     * double precision which cannot be undone by fast math optimizations */
+    float u = t * 1.44269504f;
+    int k = (int)(u + ((u < 0.f) ? -0.5f : 0.5f));
+    float r = (float)(t - k * 0.6931471805599453);
+
+    /* Evaluate the Taylor series for exp(r) with Horner's scheme */
+    float p = 1.98412698e-4f;
+    p = p * r + 1.38888889e-3f;
+    p = p * r + 8.33333333e-3f;
+    p = p * r + 4.16666667e-2f;
+    p = p * r + 1.66666667e-1f;
+    p = p * r + 0.5f;
+    p = p * r + 1.f;
+    p = p * r + 1.f;
+
+    /* Scale by 2^k by constructing the exponent bits directly */
+    int32_t bits = (k + 127) << 23;
+    float scale;
+    memcpy(&scale, &bits, sizeof(float));
+    y[i] = p * scale;
+  }
+}
+
+
+/**
+ * @brief Evaluates the exponential of an array of values with the
+ *        exp(...) intrinsic.
+ * @details This is the scalar fallback for processors without a
+ *          vectorized kernel.
+ * @param n the number of values
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+template <typename T>
+inline void vector_exp_scalar(int n, const T* x, T* y) {
+  for (int i=0; i < n; i++)
+    y[i] = exp(x[i]);
+}
+
+
+#ifdef VECTOR_EXP_DISPATCH
+
+/**
+ * @brief Evaluates the exponential of an array of values with AVX2 and
+ *        FMA vector instructions.
+ * @param n the number of values
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+template <typename T>
+__attribute__((target("avx2,fma")))
+void vector_exp_avx2(int n, const T* x, T* y) {
+  vector_exp_polynomial(n, x, y);
+
+  /* Avoid SSE transition penalties in the caller */
+  __builtin_ia32_vzeroupper();
+}
+
+
+/**
+ * @brief Evaluates the exponential of an array of values with AVX-512
+ *        vector instructions.
+ * @param n the number of values
+ * @param x the array of arguments
+ * @param y the array to store the exponentials
+ */
+template <typename T>
+__attribute__((target("avx512f")))
+void vector_exp_avx512(int n, const T* x, T* y) {
+  vector_exp_polynomial(n, x, y);
+
+  /* Avoid SSE transition penalties in the caller */
+  __builtin_ia32_vzeroupper();
+}
+
+#endif
+
+
+/**
+ * @brief Returns the name of the vector instruction set used by the
+ *        exponential kernel selected for this processor.
+ * @return "AVX-512", "AVX2" or "scalar"
+ */
+inline const char* vector_exp_isa() {
+
+#ifdef VECTOR_EXP_DISPATCH
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f"))
+    return "AVX-512";
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return "AVX2";
+#endif
+
+  return "scalar";
+}
+
+
+/**
+ * @brief Returns the fastest exponential kernel supported by the processor.
+ * @details The processor's features are queried at runtime with the
+ *          CPUID instruction.
+ * @return a pointer to the exponential kernel
+ */
+template <typename T>
+inline void (*vector_exp_function())(int, const T*, T*) {
+
+#ifdef VECTOR_EXP_DISPATCH
+  __builtin_cpu_init();
+
+  if (__builtin_cpu_supports("avx512f"))
+    return &vector_exp_avx512<T>;
+  else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return &vector_exp_avx2<T>;
+#endif
+
+  return &vector_exp_scalar<T>;
+}
+
+#endif /* VECTOR_EXP_H_ */